@@ -0,0 +1,302 @@
+/*
+ * aes-keycache.c - bounded, thread safe cache of AES key schedules
+ *
+ * Entries live in a chained hash table keyed by the raw key bytes and
+ * on a doubly linked LRU list. Key expansion on a miss runs outside
+ * the lock; evicted entries are zeroized once their last user lets go.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aes-keycache.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+typedef CRITICAL_SECTION cache_mutex;
+#define cache_mutex_init(m)     InitializeCriticalSection(m)
+#define cache_mutex_destroy(m)  DeleteCriticalSection(m)
+#define cache_mutex_lock(m)     EnterCriticalSection(m)
+#define cache_mutex_unlock(m)   LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t cache_mutex;
+#define cache_mutex_init(m)     pthread_mutex_init(m, NULL)
+#define cache_mutex_destroy(m)  pthread_mutex_destroy(m)
+#define cache_mutex_lock(m)     pthread_mutex_lock(m)
+#define cache_mutex_unlock(m)   pthread_mutex_unlock(m)
+#endif
+
+struct cache_entry {
+    AES_CACHED_KEY k;               /* must stay first, handed out to callers */
+    unsigned char userkey[32];
+    int bits;
+    unsigned long hash;
+    unsigned long refs;
+    int cached;                     /* still reachable from the table */
+    struct cache_entry *chain;      /* hash bucket */
+    struct cache_entry *prev;       /* LRU list, most recent first */
+    struct cache_entry *next;
+};
+
+struct aes_key_cache {
+    cache_mutex lock;
+    struct cache_entry **table;
+    unsigned long mask;
+    unsigned long count;
+    unsigned long capacity;
+    struct cache_entry *head;
+    struct cache_entry *tail;
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long evictions;
+};
+
+static void
+zeroize(void *p, size_t size)
+{
+    volatile unsigned char *v = (volatile unsigned char *) p;
+
+    while (size--)
+        *v++ = 0;
+}
+
+static void
+entry_free(struct cache_entry *e)
+{
+    zeroize(e, sizeof(*e));
+    free(e);
+}
+
+/* FNV-1a over the key bytes */
+static unsigned long
+key_hash(const unsigned char *userkey, int bits)
+{
+    unsigned long h = 2166136261UL ^ (unsigned long) bits;
+    int i;
+
+    for (i = 0; i < bits / 8; i++) {
+        h ^= userkey[i];
+        h *= 16777619UL;
+    }
+    return h ^ (h >> 15);
+}
+
+/* constant time, so lookups do not leak how much of a key matched */
+static int
+key_equal(const struct cache_entry *e, const unsigned char *userkey,
+          int bits, unsigned long hash)
+{
+    unsigned char diff = 0;
+    int i;
+
+    if (e->hash != hash || e->bits != bits)
+        return 0;
+    for (i = 0; i < bits / 8; i++)
+        diff |= e->userkey[i] ^ userkey[i];
+    return diff == 0;
+}
+
+static void
+lru_unlink(AES_KEY_CACHE *c, struct cache_entry *e)
+{
+    if (e->prev)
+        e->prev->next = e->next;
+    else
+        c->head = e->next;
+    if (e->next)
+        e->next->prev = e->prev;
+    else
+        c->tail = e->prev;
+    e->prev = e->next = NULL;
+}
+
+static void
+lru_push(AES_KEY_CACHE *c, struct cache_entry *e)
+{
+    e->prev = NULL;
+    e->next = c->head;
+    if (c->head)
+        c->head->prev = e;
+    else
+        c->tail = e;
+    c->head = e;
+}
+
+static struct cache_entry *
+table_find(AES_KEY_CACHE *c, const unsigned char *userkey, int bits,
+           unsigned long hash)
+{
+    struct cache_entry *e;
+
+    for (e = c->table[hash & c->mask]; e != NULL; e = e->chain) {
+        if (key_equal(e, userkey, bits, hash))
+            return e;
+    }
+    return NULL;
+}
+
+static void
+table_remove(AES_KEY_CACHE *c, struct cache_entry *e)
+{
+    struct cache_entry **pp = &c->table[e->hash & c->mask];
+
+    while (*pp != e)
+        pp = &(*pp)->chain;
+    *pp = e->chain;
+    e->chain = NULL;
+}
+
+/*
+ * Drop the least recently used entry. Returns it if nobody holds it
+ * any more and it should be freed by the caller (outside the lock).
+ */
+static struct cache_entry *
+evict_one(AES_KEY_CACHE *c)
+{
+    struct cache_entry *e = c->tail;
+
+    lru_unlink(c, e);
+    table_remove(c, e);
+    e->cached = 0;
+    c->count--;
+    c->evictions++;
+    return (e->refs == 0) ? e : NULL;
+}
+
+AES_KEY_CACHE *
+AES_key_cache_create(unsigned long capacity)
+{
+    AES_KEY_CACHE *c;
+    unsigned long buckets = 16;
+
+    if (capacity == 0)
+        return NULL;
+    while (buckets < capacity) {
+        /* no power of two table that large */
+        if (buckets > ULONG_MAX / 2)
+            return NULL;
+        buckets <<= 1;
+    }
+
+    c = calloc(1, sizeof(*c));
+    if (c == NULL)
+        return NULL;
+    c->table = calloc(buckets, sizeof(*c->table));
+    if (c->table == NULL) {
+        free(c);
+        return NULL;
+    }
+    c->mask = buckets - 1;
+    c->capacity = capacity;
+    cache_mutex_init(&c->lock);
+    return c;
+}
+
+void
+AES_key_cache_destroy(AES_KEY_CACHE *c)
+{
+    struct cache_entry *e, *next;
+
+    if (c == NULL)
+        return;
+    for (e = c->head; e != NULL; e = next) {
+        next = e->next;
+        entry_free(e);
+    }
+    cache_mutex_destroy(&c->lock);
+    free(c->table);
+    free(c);
+}
+
+const AES_CACHED_KEY *
+AES_key_cache_get(AES_KEY_CACHE *c, const unsigned char *userkey, const int bits)
+{
+    struct cache_entry *e, *fresh, *victim = NULL;
+    unsigned long hash;
+
+    if (bits != 128 && bits != 192 && bits != 256)
+        return NULL;
+    hash = key_hash(userkey, bits);
+
+    cache_mutex_lock(&c->lock);
+    e = table_find(c, userkey, bits, hash);
+    if (e != NULL) {
+        c->hits++;
+        e->refs++;
+        lru_unlink(c, e);
+        lru_push(c, e);
+        cache_mutex_unlock(&c->lock);
+        return &e->k;
+    }
+    c->misses++;
+    cache_mutex_unlock(&c->lock);
+
+    /* expand without holding the lock */
+    fresh = calloc(1, sizeof(*fresh));
+    if (fresh == NULL)
+        return NULL;
+    AES_set_encrypt_key(userkey, bits, &fresh->k.enc);
+    AES_derive_decrypt_key(&fresh->k.enc, &fresh->k.dec);
+    memcpy(fresh->userkey, userkey, bits / 8);
+    fresh->bits = bits;
+    fresh->hash = hash;
+    fresh->refs = 1;
+    fresh->cached = 1;
+
+    cache_mutex_lock(&c->lock);
+    e = table_find(c, userkey, bits, hash);
+    if (e != NULL) {
+        /* another thread inserted it meanwhile */
+        e->refs++;
+        lru_unlink(c, e);
+        lru_push(c, e);
+        cache_mutex_unlock(&c->lock);
+        entry_free(fresh);
+        return &e->k;
+    }
+    if (c->count == c->capacity)
+        victim = evict_one(c);
+    fresh->chain = c->table[hash & c->mask];
+    c->table[hash & c->mask] = fresh;
+    lru_push(c, fresh);
+    c->count++;
+    cache_mutex_unlock(&c->lock);
+
+    if (victim != NULL)
+        entry_free(victim);
+    return &fresh->k;
+}
+
+void
+AES_key_cache_release(AES_KEY_CACHE *c, const AES_CACHED_KEY *key)
+{
+    struct cache_entry *e = (struct cache_entry *) key;
+    int dead;
+
+    if (key == NULL)
+        return;
+    cache_mutex_lock(&c->lock);
+    dead = (--e->refs == 0 && !e->cached);
+    cache_mutex_unlock(&c->lock);
+
+    if (dead)
+        entry_free(e);
+}
+
+void
+AES_key_cache_stats(AES_KEY_CACHE *c, unsigned long *hits,
+                    unsigned long *misses, unsigned long *evictions)
+{
+    cache_mutex_lock(&c->lock);
+    if (hits)
+        *hits = c->hits;
+    if (misses)
+        *misses = c->misses;
+    if (evictions)
+        *evictions = c->evictions;
+    cache_mutex_unlock(&c->lock);
+}
@@ -0,0 +1,71 @@
+/*
+ * aes-keycache.h - bounded, thread safe cache of AES key schedules
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#ifndef HEIM_AES_KEYCACHE_H
+#define HEIM_AES_KEYCACHE_H 1
+
+#include "aes.h"
+
+/* symbol renaming */
+#define AES_key_cache_create hc_AES_key_cache_create
+#define AES_key_cache_destroy hc_AES_key_cache_destroy
+#define AES_key_cache_get hc_AES_key_cache_get
+#define AES_key_cache_release hc_AES_key_cache_release
+#define AES_key_cache_stats hc_AES_key_cache_stats
+
+typedef struct aes_key_cache AES_KEY_CACHE;
+
+/*
+ * Both schedules of one key. Entries handed out by the cache are
+ * shared between threads and must be treated as read-only.
+ */
+typedef struct aes_cached_key {
+    AES_KEY enc;
+    AES_KEY dec;
+} AES_CACHED_KEY;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Create a cache holding up to 'capacity' key schedules, evicting the
+ * least recently used one when full. Returns NULL on failure,
+ * including for a capacity of 0 or one too large to allocate a table for.
+ */
+AES_KEY_CACHE *AES_key_cache_create(unsigned long);
+
+/*
+ * Destroy the cache and zeroize all schedules. No entry may still be
+ * held by a caller.
+ */
+void AES_key_cache_destroy(AES_KEY_CACHE *);
+
+/*
+ * Look up the schedules for a 128, 192 or 256 bit key, expanding and
+ * inserting them on a miss. Every successful call must be paired with
+ * AES_key_cache_release(); an entry evicted while held stays valid
+ * until it is released.
+ *
+ * Returns NULL for an unsupported key size or if memory is exhausted.
+ */
+const AES_CACHED_KEY *AES_key_cache_get(AES_KEY_CACHE *,
+             const unsigned char *, const int);
+
+void AES_key_cache_release(AES_KEY_CACHE *, const AES_CACHED_KEY *);
+
+/*
+ * Number of hits, misses and evictions since creation; any of the
+ * pointers may be NULL.
+ */
+void AES_key_cache_stats(AES_KEY_CACHE *, unsigned long *,
+             unsigned long *, unsigned long *);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HEIM_AES_KEYCACHE_H */
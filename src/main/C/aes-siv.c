@@ -0,0 +1,396 @@
+/*
+ * aes-siv.c - deterministic authenticated encryption, AES-SIV (RFC 5297)
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#include <string.h>
+
+#include "aes-siv.h"
+
+/*
+ * Number of rows whose S2V chains run side by side, and number of CTR
+ * blocks handed to the cipher kernel at once.
+ */
+#define SIV_LANES 8
+
+struct siv_lane {
+    const unsigned char *m;             /* last S2V component (plaintext) */
+    unsigned long len;
+    unsigned long blocks;               /* number of CMAC blocks of T */
+    unsigned char d[AES_BLOCK_SIZE];    /* D, or dbl(D) if len < 16 */
+    unsigned char x[AES_BLOCK_SIZE];    /* CMAC chaining value */
+};
+
+static void
+zeroize(void *p, unsigned long size)
+{
+    volatile unsigned char *v = (volatile unsigned char *) p;
+
+    while (size--)
+        *v++ = 0;
+}
+
+/* multiply by x in GF(2^128) */
+static void
+dbl(unsigned char *b)
+{
+    unsigned char carry = b[0] >> 7;
+    int i;
+
+    for (i = 0; i < AES_BLOCK_SIZE - 1; i++)
+        b[i] = (unsigned char) ((b[i] << 1) | (b[i + 1] >> 7));
+    b[AES_BLOCK_SIZE - 1] = (unsigned char) ((b[AES_BLOCK_SIZE - 1] << 1) ^ (carry * 0x87));
+}
+
+static void
+xor_block(unsigned char *out, const unsigned char *in)
+{
+    int i;
+
+    for (i = 0; i < AES_BLOCK_SIZE; i++)
+        out[i] ^= in[i];
+}
+
+static void
+cmac(const AES_SIV_CTX *ctx, const unsigned char *m, unsigned long len,
+     unsigned char *mac)
+{
+    unsigned char x[AES_BLOCK_SIZE];
+    unsigned long i;
+
+    memset(x, 0, sizeof(x));
+    while (len > AES_BLOCK_SIZE) {
+        xor_block(x, m);
+        AES_encrypt(x, x, &ctx->mac);
+        m += AES_BLOCK_SIZE;
+        len -= AES_BLOCK_SIZE;
+    }
+    if (len == AES_BLOCK_SIZE) {
+        xor_block(x, m);
+        xor_block(x, ctx->k1);
+    } else {
+        for (i = 0; i < len; i++)
+            x[i] ^= m[i];
+        x[len] ^= 0x80;
+        xor_block(x, ctx->k2);
+    }
+    AES_encrypt(x, mac, &ctx->mac);
+}
+
+/*
+ * S2V over the associated data only; the result is the D every row
+ * of a batch starts from.
+ */
+static void
+s2v_header(const AES_SIV_CTX *ctx, const unsigned char *const *ad,
+           const unsigned long *adlen, int nad, unsigned char *d)
+{
+    unsigned char mac[AES_BLOCK_SIZE];
+    int i;
+
+    memcpy(d, ctx->d0, AES_BLOCK_SIZE);
+    for (i = 0; i < nad; i++) {
+        dbl(d);
+        cmac(ctx, ad[i], adlen[i], mac);
+        xor_block(d, mac);
+    }
+}
+
+static void
+s2v_lane_init(struct siv_lane *lane, const unsigned char *d,
+              const unsigned char *m, unsigned long len)
+{
+    lane->m = m;
+    lane->len = len;
+    memcpy(lane->d, d, AES_BLOCK_SIZE);
+    memset(lane->x, 0, AES_BLOCK_SIZE);
+    if (len < AES_BLOCK_SIZE) {
+        /* T = dbl(D) xor pad(Sn) */
+        dbl(lane->d);
+        lane->blocks = 1;
+    } else {
+        /* T = Sn xorend D */
+        lane->blocks = (len + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE;
+    }
+}
+
+/*
+ * Build the input of the cipher for CMAC block 'j' of a lane's T,
+ * i.e. the chaining value xored with the (padded, subkeyed) block.
+ */
+static void
+s2v_lane_block(const AES_SIV_CTX *ctx, const struct siv_lane *lane,
+               unsigned long j, unsigned char *b)
+{
+    unsigned long off = j * AES_BLOCK_SIZE;
+    unsigned long n, end, i;
+
+    if (lane->len < AES_BLOCK_SIZE) {
+        memcpy(b, lane->d, AES_BLOCK_SIZE);
+        for (i = 0; i < lane->len; i++)
+            b[i] ^= lane->m[i];
+        b[lane->len] ^= 0x80;
+        xor_block(b, ctx->k1);
+    } else {
+        n = lane->len - off;
+        if (n > AES_BLOCK_SIZE)
+            n = AES_BLOCK_SIZE;
+        memcpy(b, lane->m + off, n);
+        memset(b + n, 0, AES_BLOCK_SIZE - n);
+        /* the last 16 bytes of T carry D */
+        end = lane->len - AES_BLOCK_SIZE;
+        for (i = (end > off) ? end - off : 0; i < n; i++)
+            b[i] ^= lane->d[off + i - end];
+        if (j == lane->blocks - 1) {
+            if (n == AES_BLOCK_SIZE) {
+                xor_block(b, ctx->k1);
+            } else {
+                b[n] = 0x80;
+                xor_block(b, ctx->k2);
+            }
+        }
+    }
+    xor_block(b, lane->x);
+}
+
+/*
+ * Finish S2V for up to SIV_LANES rows. Every step advances each
+ * unfinished chain by one block and encrypts all of them in a single
+ * call, leaving V in lane[i].x.
+ */
+static void
+s2v_lanes(const AES_SIV_CTX *ctx, struct siv_lane *lane, int nlanes)
+{
+    unsigned char buf[SIV_LANES * AES_BLOCK_SIZE];
+    int idx[SIV_LANES];
+    unsigned long j;
+    int i, k;
+
+    for (j = 0; ; j++) {
+        for (i = k = 0; i < nlanes; i++) {
+            if (j < lane[i].blocks) {
+                s2v_lane_block(ctx, &lane[i], j, buf + k * AES_BLOCK_SIZE);
+                idx[k++] = i;
+            }
+        }
+        if (k == 0)
+            break;
+        AES_encrypt_blocks(buf, buf, k, &ctx->mac);
+        for (i = 0; i < k; i++)
+            memcpy(lane[idx[i]].x, buf + i * AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+    }
+}
+
+struct siv_ctr_job {
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned long len;
+};
+
+static void
+ctr_flush(const AES_SIV_CTX *ctx, unsigned char *ks,
+          const struct siv_ctr_job *job, int k)
+{
+    unsigned long i;
+    int j;
+
+    AES_encrypt_blocks(ks, ks, k, &ctx->ctr);
+    for (j = 0; j < k; j++) {
+        for (i = 0; i < job[j].len; i++)
+            job[j].out[i] = job[j].in[i] ^ ks[j * AES_BLOCK_SIZE + i];
+    }
+}
+
+/*
+ * CTR for up to SIV_LANES rows; counter blocks of all rows are batched
+ * together, so many short values share one call into the kernel.
+ */
+static void
+ctr_lanes(const AES_SIV_CTX *ctx, const unsigned char *const *v,
+          const unsigned char *const *in, const unsigned long *len,
+          unsigned char *const *out, int nlanes)
+{
+    unsigned char ks[SIV_LANES * AES_BLOCK_SIZE];
+    unsigned char q[AES_BLOCK_SIZE];
+    struct siv_ctr_job job[SIV_LANES];
+    unsigned long off;
+    int i, j, k = 0;
+
+    for (i = 0; i < nlanes; i++) {
+        memcpy(q, v[i], AES_BLOCK_SIZE);
+        q[8] &= 0x7f;
+        q[12] &= 0x7f;
+        for (off = 0; off < len[i]; off += AES_BLOCK_SIZE) {
+            memcpy(ks + k * AES_BLOCK_SIZE, q, AES_BLOCK_SIZE);
+            for (j = AES_BLOCK_SIZE - 1; j >= 0; j--) {
+                if (++q[j])
+                    break;
+            }
+            job[k].in = in[i] + off;
+            job[k].out = out[i] + off;
+            job[k].len = len[i] - off;
+            if (job[k].len > AES_BLOCK_SIZE)
+                job[k].len = AES_BLOCK_SIZE;
+            if (++k == SIV_LANES) {
+                ctr_flush(ctx, ks, job, k);
+                k = 0;
+            }
+        }
+    }
+    if (k)
+        ctr_flush(ctx, ks, job, k);
+    zeroize(ks, sizeof(ks));
+}
+
+int
+AES_SIV_set_key(const unsigned char *userkey, const int bits, AES_SIV_CTX *ctx)
+{
+    unsigned char l[AES_BLOCK_SIZE];
+    int half = bits / 2;
+
+    if (bits != 256 && bits != 384 && bits != 512)
+        return -1;
+    if (AES_set_encrypt_key(userkey, half, &ctx->mac) != 0 ||
+        AES_set_encrypt_key(userkey + half / 8, half, &ctx->ctr) != 0)
+        return -1;
+
+    memset(l, 0, sizeof(l));
+    AES_encrypt(l, l, &ctx->mac);
+    memcpy(ctx->k1, l, AES_BLOCK_SIZE);
+    dbl(ctx->k1);
+    memcpy(ctx->k2, ctx->k1, AES_BLOCK_SIZE);
+    dbl(ctx->k2);
+    zeroize(l, sizeof(l));
+
+    memset(l, 0, sizeof(l));
+    cmac(ctx, l, AES_BLOCK_SIZE, ctx->d0);
+    return 0;
+}
+
+void
+AES_SIV_cleanup(AES_SIV_CTX *ctx)
+{
+    zeroize(ctx, sizeof(*ctx));
+}
+
+int
+AES_SIV_encrypt_batch(const AES_SIV_CTX *ctx,
+                      const unsigned char *const *ad, const unsigned long *adlen,
+                      int nad, unsigned long rows,
+                      const unsigned char *const *in, const unsigned long *size,
+                      unsigned char *const *out)
+{
+    struct siv_lane lane[SIV_LANES];
+    const unsigned char *v[SIV_LANES];
+    const unsigned char *src[SIV_LANES];
+    unsigned char *dst[SIV_LANES];
+    unsigned long len[SIV_LANES];
+    unsigned char d[AES_BLOCK_SIZE];
+    unsigned long r;
+    int i, n;
+
+    if (nad < 0 || nad > AES_SIV_MAX_AD)
+        return -1;
+    s2v_header(ctx, ad, adlen, nad, d);
+
+    for (r = 0; r < rows; r += n) {
+        n = (rows - r > SIV_LANES) ? SIV_LANES : (int) (rows - r);
+        for (i = 0; i < n; i++)
+            s2v_lane_init(&lane[i], d, in[r + i], size[r + i]);
+        s2v_lanes(ctx, lane, n);
+        for (i = 0; i < n; i++) {
+            memcpy(out[r + i], lane[i].x, AES_SIV_TAG_SIZE);
+            v[i] = out[r + i];
+            src[i] = in[r + i];
+            dst[i] = out[r + i] + AES_SIV_TAG_SIZE;
+            len[i] = size[r + i];
+        }
+        ctr_lanes(ctx, v, src, len, dst, n);
+    }
+    zeroize(d, sizeof(d));
+    zeroize(lane, sizeof(lane));
+    return 0;
+}
+
+long
+AES_SIV_decrypt_batch(const AES_SIV_CTX *ctx,
+                      const unsigned char *const *ad, const unsigned long *adlen,
+                      int nad, unsigned long rows,
+                      const unsigned char *const *in, const unsigned long *size,
+                      unsigned char *const *out, int *status)
+{
+    struct siv_lane lane[SIV_LANES];
+    const unsigned char *v[SIV_LANES];
+    const unsigned char *src[SIV_LANES];
+    unsigned char *dst[SIV_LANES];
+    unsigned long len[SIV_LANES];
+    unsigned long row[SIV_LANES];
+    unsigned char tag[SIV_LANES][AES_SIV_TAG_SIZE];
+    unsigned char d[AES_BLOCK_SIZE];
+    unsigned char diff;
+    unsigned long r;
+    long failed = 0;
+    int i, j, n;
+
+    if (nad < 0 || nad > AES_SIV_MAX_AD)
+        return -1;
+    s2v_header(ctx, ad, adlen, nad, d);
+
+    for (r = 0; r < rows; ) {
+        for (n = 0; n < SIV_LANES && r < rows; r++) {
+            if (size[r] < AES_SIV_TAG_SIZE) {
+                if (status)
+                    status[r] = -1;
+                failed++;
+                continue;
+            }
+            /* V may be overwritten by the plaintext if out[r] == in[r] */
+            memcpy(tag[n], in[r], AES_SIV_TAG_SIZE);
+            row[n] = r;
+            v[n] = tag[n];
+            src[n] = in[r] + AES_SIV_TAG_SIZE;
+            dst[n] = out[r];
+            len[n] = size[r] - AES_SIV_TAG_SIZE;
+            n++;
+        }
+        if (n == 0)
+            continue;
+        ctr_lanes(ctx, v, src, len, dst, n);
+        for (i = 0; i < n; i++)
+            s2v_lane_init(&lane[i], d, dst[i], len[i]);
+        s2v_lanes(ctx, lane, n);
+        for (i = 0; i < n; i++) {
+            for (j = 0, diff = 0; j < AES_SIV_TAG_SIZE; j++)
+                diff |= lane[i].x[j] ^ v[i][j];
+            if (diff) {
+                zeroize(dst[i], len[i]);
+                failed++;
+            }
+            if (status)
+                status[row[i]] = diff ? -1 : 0;
+        }
+    }
+    zeroize(d, sizeof(d));
+    zeroize(lane, sizeof(lane));
+    zeroize(tag, sizeof(tag));
+    return failed;
+}
+
+int
+AES_SIV_encrypt(const AES_SIV_CTX *ctx,
+                const unsigned char *const *ad, const unsigned long *adlen,
+                int nad, const unsigned char *in, unsigned long size,
+                unsigned char *out)
+{
+    return AES_SIV_encrypt_batch(ctx, ad, adlen, nad, 1, &in, &size, &out);
+}
+
+int
+AES_SIV_decrypt(const AES_SIV_CTX *ctx,
+                const unsigned char *const *ad, const unsigned long *adlen,
+                int nad, const unsigned char *in, unsigned long size,
+                unsigned char *out)
+{
+    return AES_SIV_decrypt_batch(ctx, ad, adlen, nad, 1, &in, &size, &out, NULL) == 0 ? 0 : -1;
+}
@@ -0,0 +1,108 @@
+/*
+ * aes-siv.h - deterministic authenticated encryption, AES-SIV (RFC 5297)
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#ifndef HEIM_AES_SIV_H
+#define HEIM_AES_SIV_H 1
+
+#include "aes.h"
+
+/* symbol renaming */
+#define AES_SIV_set_key hc_AES_SIV_set_key
+#define AES_SIV_cleanup hc_AES_SIV_cleanup
+#define AES_SIV_encrypt hc_AES_SIV_encrypt
+#define AES_SIV_decrypt hc_AES_SIV_decrypt
+#define AES_SIV_encrypt_batch hc_AES_SIV_encrypt_batch
+#define AES_SIV_decrypt_batch hc_AES_SIV_decrypt_batch
+
+/*
+ * Size of the synthetic IV that is prepended to every ciphertext.
+ */
+#define AES_SIV_TAG_SIZE AES_BLOCK_SIZE
+
+/*
+ * Maximum number of associated data strings (RFC 5297 allows 126
+ * components, one of which is the plaintext).
+ */
+#define AES_SIV_MAX_AD 125
+
+typedef struct aes_siv_ctx {
+    AES_KEY mac;                          /* K1, used by S2V */
+    AES_KEY ctr;                          /* K2, used by CTR */
+    unsigned char k1[AES_BLOCK_SIZE];     /* CMAC subkeys of K1 */
+    unsigned char k2[AES_BLOCK_SIZE];
+    unsigned char d0[AES_BLOCK_SIZE];     /* CMAC(K1, <zero>) */
+} AES_SIV_CTX;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * 'bits' is the size of the whole SIV key: 256, 384 or 512. The first
+ * half keys S2V, the second half keys CTR.
+ *
+ * Returns 0 on success, -1 for an unsupported key size.
+ */
+int AES_SIV_set_key(const unsigned char *, const int, AES_SIV_CTX *);
+
+/* Zeroize all key material in the context. */
+void AES_SIV_cleanup(AES_SIV_CTX *);
+
+/*
+ * Encrypt 'size' bytes to 'out', which receives AES_SIV_TAG_SIZE + size
+ * bytes (V || C). 'ad' and 'adlen' describe 'nad' associated data
+ * strings; 'ad' may be NULL if 'nad' is 0. 'in' and 'out' must not
+ * overlap, except that 'in' may be out + AES_SIV_TAG_SIZE to encrypt in
+ * place behind room left for V.
+ *
+ * Returns 0 on success, -1 if 'nad' exceeds AES_SIV_MAX_AD.
+ */
+int AES_SIV_encrypt(const AES_SIV_CTX *,
+             const unsigned char *const *, const unsigned long *, int,
+             const unsigned char *, unsigned long, unsigned char *);
+
+/*
+ * Decrypt 'size' bytes of V || C to 'out', which receives
+ * size - AES_SIV_TAG_SIZE bytes. 'in' and 'out' must not overlap, except
+ * that 'out' may be 'in' or in + AES_SIV_TAG_SIZE to decrypt in place.
+ *
+ * Returns 0 on success, -1 if the input is too short, 'nad' is out of
+ * range or authentication fails; in the latter case 'out' is zeroed.
+ */
+int AES_SIV_decrypt(const AES_SIV_CTX *,
+             const unsigned char *const *, const unsigned long *, int,
+             const unsigned char *, unsigned long, unsigned char *);
+
+/*
+ * Column variants: encrypt or decrypt 'rows' values under the same
+ * associated data (e.g. table and column name). Row i reads size[i]
+ * bytes from in[i] and writes to out[i] with the sizes described for
+ * AES_SIV_encrypt() and AES_SIV_decrypt(), which may overlap as
+ * described there.
+ *
+ * The S2V chains of neighbouring rows are run side by side and the CTR
+ * keystream of several rows is produced in one batch, so short values
+ * keep the cipher kernel busy.
+ *
+ * AES_SIV_encrypt_batch() returns 0, or -1 if 'nad' is out of range.
+ * AES_SIV_decrypt_batch() returns the number of rows that failed, or -1
+ * if 'nad' is out of range; if 'status' is not NULL, status[i] is set
+ * to 0 or -1 as AES_SIV_decrypt() would return for row i.
+ */
+int AES_SIV_encrypt_batch(const AES_SIV_CTX *,
+             const unsigned char *const *, const unsigned long *, int,
+             unsigned long, const unsigned char *const *,
+             const unsigned long *, unsigned char *const *);
+long AES_SIV_decrypt_batch(const AES_SIV_CTX *,
+             const unsigned char *const *, const unsigned long *, int,
+             unsigned long, const unsigned char *const *,
+             const unsigned long *, unsigned char *const *, int *);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HEIM_AES_SIV_H */
@@ -0,0 +1,146 @@
+/*
+ * aes-token.c - opaque, fixed width tokens from 16 byte identifiers
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#include <string.h>
+
+#include "aes-token.h"
+#include "simd.h"
+
+/* identifiers encrypted per call into the cipher kernel */
+#define TOKEN_BATCH 16
+
+static const char url_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/* encode 3 bytes to 4 characters */
+static void
+encode_group(const unsigned char *b, char *out)
+{
+    out[0] = url_alphabet[b[0] >> 2];
+    out[1] = url_alphabet[((b[0] & 0x03) << 4) | (b[1] >> 4)];
+    out[2] = url_alphabet[((b[1] & 0x0f) << 2) | (b[2] >> 6)];
+    out[3] = url_alphabet[b[2] & 0x3f];
+}
+
+#if defined(SIMD_SSSE3)
+/*
+ * Encode the first 12 bytes of a block to 16 characters: spread the
+ * bytes over 32 bit lanes, cut out the four sextets with two
+ * multiplies, and map 0..63 to ASCII with a 16 entry offset table.
+ */
+static void
+encode_12(const unsigned char *b, char *out)
+{
+    const __m128i shift_lut = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '-' - 62,
+        '_' - 63, 'A', 0, 0);
+    __m128i in, t0, t1, t2, t3, idx, res;
+
+    in = _mm_loadu_si128((const __m128i *) b);
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    idx = _mm_or_si128(t1, t3);
+
+    /* 0..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12, then 0..25 -> 13 */
+    res = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+    res = _mm_or_si128(res, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), idx), _mm_set1_epi8(13)));
+    res = _mm_add_epi8(_mm_shuffle_epi8(shift_lut, res), idx);
+    _mm_storeu_si128((__m128i *) out, res);
+}
+#endif /* SIMD_SSSE3 */
+
+/* encode one 16 byte block to AES_TOKEN_SIZE characters */
+static void
+encode_token(const unsigned char *b, char *out)
+{
+#if defined(SIMD_SSSE3)
+    encode_12(b, out);
+#else
+    encode_group(b, out);
+    encode_group(b + 3, out + 4);
+    encode_group(b + 6, out + 8);
+    encode_group(b + 9, out + 12);
+#endif
+    encode_group(b + 12, out + 16);
+    out[20] = url_alphabet[b[15] >> 2];
+    out[21] = url_alphabet[(b[15] & 0x03) << 4];
+}
+
+static int
+decode_value(unsigned char c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if (c == '-')
+        return 62;
+    if (c == '_')
+        return 63;
+    return -1;
+}
+
+/* decode AES_TOKEN_SIZE characters to 16 bytes, -1 if malformed */
+static int
+decode_token(const char *in, unsigned char *b)
+{
+    int v[AES_TOKEN_SIZE];
+    int i, bad = 0;
+
+    for (i = 0; i < AES_TOKEN_SIZE; i++) {
+        v[i] = decode_value((unsigned char) in[i]);
+        bad |= v[i];
+    }
+    /* the last character only carries two bits */
+    if (bad < 0 || (v[AES_TOKEN_SIZE - 1] & 0x0f))
+        return -1;
+    for (i = 0; i < 5; i++) {
+        b[3 * i    ] = (unsigned char) ((v[4 * i] << 2) | (v[4 * i + 1] >> 4));
+        b[3 * i + 1] = (unsigned char) ((v[4 * i + 1] << 4) | (v[4 * i + 2] >> 2));
+        b[3 * i + 2] = (unsigned char) ((v[4 * i + 2] << 6) | v[4 * i + 3]);
+    }
+    b[15] = (unsigned char) ((v[20] << 2) | (v[21] >> 4));
+    return 0;
+}
+
+void
+AES_tokens_encrypt(const unsigned char *ids, unsigned long n,
+                   char *out, const AES_KEY *key)
+{
+    unsigned char ct[TOKEN_BATCH * AES_BLOCK_SIZE];
+    unsigned long blocks, i;
+
+    while (n) {
+        blocks = (n > TOKEN_BATCH) ? TOKEN_BATCH : n;
+        AES_encrypt_blocks(ids, ct, blocks, key);
+        for (i = 0; i < blocks; i++)
+            encode_token(ct + i * AES_BLOCK_SIZE, out + i * AES_TOKEN_SIZE);
+        ids += blocks * AES_BLOCK_SIZE;
+        out += blocks * AES_TOKEN_SIZE;
+        n -= blocks;
+    }
+}
+
+unsigned long
+AES_tokens_decrypt(const char *tokens, unsigned long n,
+                   unsigned char *ids, const AES_KEY *key)
+{
+    unsigned char ct[AES_BLOCK_SIZE];
+    unsigned long i;
+
+    for (i = 0; i < n; i++) {
+        if (decode_token(tokens + i * AES_TOKEN_SIZE, ct) != 0)
+            break;
+        AES_decrypt(ct, ids + i * AES_BLOCK_SIZE, key);
+    }
+    return i;
+}
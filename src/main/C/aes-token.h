@@ -0,0 +1,47 @@
+/*
+ * aes-token.h - opaque, fixed width tokens from 16 byte identifiers
+ *
+ * A token is the AES encryption of an identifier, written as 22
+ * characters of unpadded base64url (RFC 4648, section 5).
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#ifndef HEIM_AES_TOKEN_H
+#define HEIM_AES_TOKEN_H 1
+
+#include "aes.h"
+
+/* symbol renaming */
+#define AES_tokens_encrypt hc_AES_tokens_encrypt
+#define AES_tokens_decrypt hc_AES_tokens_decrypt
+
+#define AES_TOKEN_SIZE 22
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Mint 'n' tokens from the 16 byte identifiers at 'ids' (n * 16 bytes)
+ * into 'out', which receives n * AES_TOKEN_SIZE characters back to back
+ * and no terminator. 'key' is an encryption key.
+ */
+void AES_tokens_encrypt(const unsigned char *, unsigned long,
+             char *, const AES_KEY *);
+
+/*
+ * Recover the identifiers of 'n' tokens stored back to back at
+ * 'tokens'. 'key' is a decryption key.
+ *
+ * Returns the number of tokens decoded; a value less than 'n' is the
+ * index of the first malformed token, at which decoding stopped.
+ */
+unsigned long AES_tokens_decrypt(const char *, unsigned long,
+             unsigned char *, const AES_KEY *);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HEIM_AES_TOKEN_H */
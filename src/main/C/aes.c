@@ -36,6 +36,12 @@
 #include "rijndael-alg-fst.h"
 #include "aes.h"
 
+/*
+ * Number of blocks of keystream that CFB128 decryption and OFB produce
+ * per batch.
+ */
+#define AES_KS_BATCH 8
+
 int
 AES_set_encrypt_key(const unsigned char *userkey, const int bits, AES_KEY *key)
 {
@@ -54,6 +60,17 @@ AES_set_decrypt_key(const unsigned char *userkey, const int bits, AES_KEY *key)
     return 0;
 }
 
+/*
+ * Turn an encryption key into the matching decryption key. Cheaper than
+ * AES_set_decrypt_key(), which expands the user key again.
+ */
+void
+AES_derive_decrypt_key(const AES_KEY *enc, AES_KEY *dec)
+{
+    rijndaelKeySetupDecFromEnc(dec->key, enc->key, enc->rounds);
+    dec->rounds = enc->rounds;
+}
+
 void
 AES_encrypt(const unsigned char *in, unsigned char *out, const AES_KEY *key)
 {
@@ -66,9 +83,70 @@ AES_decrypt(const unsigned char *in, unsigned char *out, const AES_KEY *key)
     rijndaelDecrypt(key->key, key->rounds, in, out);
 }
 
+/*
+ * Encrypt 'blocks' independent 16 byte blocks (ECB). 'in' and 'out'
+ * may be the same buffer.
+ */
 void
-AES_cbc_encrypt(const unsigned char *in, unsigned char *out,
-        unsigned long size, const AES_KEY *key,
+AES_encrypt_blocks(const unsigned char *in, unsigned char *out,
+           unsigned long blocks, const AES_KEY *key)
+{
+    rijndaelEncryptBlocks(key->key, key->rounds, in, out, blocks);
+}
+
+static void
+xor_bytes(unsigned char *out, const unsigned char *a,
+      const unsigned char *b, unsigned long size)
+{
+    unsigned long i;
+
+    for (i = 0; i < size; i++)
+        out[i] = a[i] ^ b[i];
+}
+
+/*
+ * Dual direction keys.
+ */
+
+int
+AES_set_dual_key(const unsigned char *userkey, const int bits, AES_DUAL_KEY *key)
+{
+    key->dec_ready = 0;
+    key->rounds = rijndaelKeySetupEnc(key->enc, userkey, bits);
+    if (key->rounds == 0)
+        return -1;
+    return 0;
+}
+
+/*
+ * Derive the decryption schedule now instead of on the first
+ * decryption. Call this before sharing a key between threads.
+ */
+void
+AES_dual_prepare_decrypt(AES_DUAL_KEY *key)
+{
+    if (!key->dec_ready) {
+        rijndaelKeySetupDecFromEnc(key->dec, key->enc, key->rounds);
+        key->dec_ready = 1;
+    }
+}
+
+void
+AES_dual_encrypt(const unsigned char *in, unsigned char *out, const AES_DUAL_KEY *key)
+{
+    rijndaelEncrypt(key->enc, key->rounds, in, out);
+}
+
+void
+AES_dual_decrypt(const unsigned char *in, unsigned char *out, AES_DUAL_KEY *key)
+{
+    AES_dual_prepare_decrypt(key);
+    rijndaelDecrypt(key->dec, key->rounds, in, out);
+}
+
+static void
+cbc_encrypt(const unsigned char *in, unsigned char *out,
+        unsigned long size, const uint32_t *rk, int rounds,
         unsigned char *iv, int forward_encrypt)
 {
     unsigned char tmp[AES_BLOCK_SIZE];
@@ -78,7 +156,7 @@ AES_cbc_encrypt(const unsigned char *in, unsigned char *out,
         while (size >= AES_BLOCK_SIZE) {
             for (i = 0; i < AES_BLOCK_SIZE; i++)
             tmp[i] = in[i] ^ iv[i];
-            AES_encrypt(tmp, out, key);
+            rijndaelEncrypt(rk, rounds, tmp, out);
             memcpy(iv, out, AES_BLOCK_SIZE);
             size -= AES_BLOCK_SIZE;
             in += AES_BLOCK_SIZE;
@@ -89,13 +167,13 @@ AES_cbc_encrypt(const unsigned char *in, unsigned char *out,
                 tmp[i] = in[i] ^ iv[i];
             for (i = size; i < AES_BLOCK_SIZE; i++)
                 tmp[i] = iv[i];
-            AES_encrypt(tmp, out, key);
+            rijndaelEncrypt(rk, rounds, tmp, out);
             memcpy(iv, out, AES_BLOCK_SIZE);
         }
     } else {
         while (size >= AES_BLOCK_SIZE) {
             memcpy(tmp, in, AES_BLOCK_SIZE);
-            AES_decrypt(tmp, out, key);
+            rijndaelDecrypt(rk, rounds, tmp, out);
             for (i = 0; i < AES_BLOCK_SIZE; i++)
             out[i] ^= iv[i];
             memcpy(iv, tmp, AES_BLOCK_SIZE);
@@ -105,7 +183,7 @@ AES_cbc_encrypt(const unsigned char *in, unsigned char *out,
         }
         if (size) {
             memcpy(tmp, in, AES_BLOCK_SIZE);
-            AES_decrypt(tmp, out, key);
+            rijndaelDecrypt(rk, rounds, tmp, out);
             for (i = 0; i < size; i++)
                 out[i] ^= iv[i];
             memcpy(iv, tmp, AES_BLOCK_SIZE);
@@ -113,6 +191,27 @@ AES_cbc_encrypt(const unsigned char *in, unsigned char *out,
     }
 }
 
+void
+AES_cbc_encrypt(const unsigned char *in, unsigned char *out,
+        unsigned long size, const AES_KEY *key,
+        unsigned char *iv, int forward_encrypt)
+{
+    cbc_encrypt(in, out, size, key->key, key->rounds, iv, forward_encrypt);
+}
+
+void
+AES_dual_cbc_encrypt(const unsigned char *in, unsigned char *out,
+        unsigned long size, AES_DUAL_KEY *key,
+        unsigned char *iv, int forward_encrypt)
+{
+    if (forward_encrypt) {
+        cbc_encrypt(in, out, size, key->enc, key->rounds, iv, 1);
+    } else {
+        AES_dual_prepare_decrypt(key);
+        cbc_encrypt(in, out, size, key->dec, key->rounds, iv, 0);
+    }
+}
+
 void
 AES_cfb8_encrypt(const unsigned char *in, unsigned char *out,
                  unsigned long size, const AES_KEY *key,
@@ -135,6 +234,118 @@ AES_cfb8_encrypt(const unsigned char *in, unsigned char *out,
     }
 }
 
+/*
+ * Full block CFB. '*num' is the offset into the current keystream block
+ * and must be 0 at the start of a message; 'iv' and '*num' carry the
+ * stream position from one call to the next, so a message may be fed
+ * in pieces of any size.
+ *
+ * Decryption computes the keystream for AES_KS_BATCH blocks at once,
+ * since all of it is known from the ciphertext up front.
+ */
+void
+AES_cfb128_encrypt(const unsigned char *in, unsigned char *out,
+                   unsigned long size, const AES_KEY *key,
+                   unsigned char *iv, int *num, int forward_encrypt)
+{
+    unsigned char fb[AES_KS_BATCH * AES_BLOCK_SIZE];
+    unsigned long blocks;
+    unsigned int n = *num & (AES_BLOCK_SIZE - 1);
+    unsigned int i;
+    unsigned char c;
+
+    /* use up what is left of the current keystream block */
+    while (n && size) {
+        c = *in++;
+        *out++ = c ^ iv[n];
+        iv[n] = forward_encrypt ? (c ^ iv[n]) : c;
+        n = (n + 1) & (AES_BLOCK_SIZE - 1);
+        size--;
+    }
+
+    if (forward_encrypt) {
+        while (size >= AES_BLOCK_SIZE) {
+            AES_encrypt(iv, iv, key);
+            for (i = 0; i < AES_BLOCK_SIZE; i++)
+                iv[i] = out[i] = in[i] ^ iv[i];
+            size -= AES_BLOCK_SIZE;
+            in += AES_BLOCK_SIZE;
+            out += AES_BLOCK_SIZE;
+        }
+    } else {
+        while (size >= AES_BLOCK_SIZE) {
+            blocks = size / AES_BLOCK_SIZE;
+            if (blocks > AES_KS_BATCH)
+                blocks = AES_KS_BATCH;
+            memcpy(fb, iv, AES_BLOCK_SIZE);
+            memcpy(fb + AES_BLOCK_SIZE, in, (blocks - 1) * AES_BLOCK_SIZE);
+            memcpy(iv, in + (blocks - 1) * AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+            AES_encrypt_blocks(fb, fb, blocks, key);
+            xor_bytes(out, in, fb, blocks * AES_BLOCK_SIZE);
+            size -= blocks * AES_BLOCK_SIZE;
+            in += blocks * AES_BLOCK_SIZE;
+            out += blocks * AES_BLOCK_SIZE;
+        }
+    }
+
+    if (size) {
+        AES_encrypt(iv, iv, key);
+        while (size--) {
+            c = in[n];
+            out[n] = c ^ iv[n];
+            iv[n] = forward_encrypt ? (c ^ iv[n]) : c;
+            n++;
+        }
+    }
+    *num = n;
+}
+
+/*
+ * OFB, same calling convention as AES_cfb128_encrypt(); encryption and
+ * decryption are the same operation. The keystream is generated
+ * AES_KS_BATCH blocks ahead and then applied in one pass.
+ */
+void
+AES_ofb128_encrypt(const unsigned char *in, unsigned char *out,
+                   unsigned long size, const AES_KEY *key,
+                   unsigned char *iv, int *num)
+{
+    unsigned char ks[AES_KS_BATCH * AES_BLOCK_SIZE];
+    const unsigned char *prev;
+    unsigned long blocks, i;
+    unsigned int n = *num & (AES_BLOCK_SIZE - 1);
+
+    while (n && size) {
+        *out++ = *in++ ^ iv[n];
+        n = (n + 1) & (AES_BLOCK_SIZE - 1);
+        size--;
+    }
+
+    while (size >= AES_BLOCK_SIZE) {
+        blocks = size / AES_BLOCK_SIZE;
+        if (blocks > AES_KS_BATCH)
+            blocks = AES_KS_BATCH;
+        for (i = 0, prev = iv; i < blocks; i++) {
+            AES_encrypt(prev, ks + i * AES_BLOCK_SIZE, key);
+            prev = ks + i * AES_BLOCK_SIZE;
+        }
+        memcpy(iv, prev, AES_BLOCK_SIZE);
+        xor_bytes(out, in, ks, blocks * AES_BLOCK_SIZE);
+        size -= blocks * AES_BLOCK_SIZE;
+        in += blocks * AES_BLOCK_SIZE;
+        out += blocks * AES_BLOCK_SIZE;
+    }
+
+    if (size) {
+        AES_encrypt(iv, iv, key);
+        while (size--) {
+            out[n] = in[n] ^ iv[n];
+            n++;
+        }
+    }
+    *num = n;
+}
+
 static void
 AES_cfb8_encrypt_(const unsigned char *in, unsigned char *out,
                  unsigned long size, const AES_KEY *key,
@@ -161,3 +372,39 @@ AES_Decrypt_CFB8_NoPadding(const unsigned char *in, unsigned char *out,
 {
     AES_cfb8_encrypt_(in, out, size, key, iv, 0);
 }
+
+void
+AES_Encrypt_CFB128_NoPadding(const unsigned char *in, unsigned char *out,
+                 unsigned long size, const AES_KEY *key,
+                 const unsigned char *iv)
+{
+    unsigned char iv_[AES_BLOCK_SIZE];
+    int num = 0;
+    memcpy(iv_, iv, AES_BLOCK_SIZE);
+
+    AES_cfb128_encrypt(in, out, size, key, iv_, &num, 1);
+}
+
+void
+AES_Decrypt_CFB128_NoPadding(const unsigned char *in, unsigned char *out,
+                 unsigned long size, const AES_KEY *key,
+                 const unsigned char *iv)
+{
+    unsigned char iv_[AES_BLOCK_SIZE];
+    int num = 0;
+    memcpy(iv_, iv, AES_BLOCK_SIZE);
+
+    AES_cfb128_encrypt(in, out, size, key, iv_, &num, 0);
+}
+
+void
+AES_Crypt_OFB_NoPadding(const unsigned char *in, unsigned char *out,
+                 unsigned long size, const AES_KEY *key,
+                 const unsigned char *iv)
+{
+    unsigned char iv_[AES_BLOCK_SIZE];
+    int num = 0;
+    memcpy(iv_, iv, AES_BLOCK_SIZE);
+
+    AES_ofb128_encrypt(in, out, size, key, iv_, &num);
+}
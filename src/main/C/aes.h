@@ -40,17 +40,26 @@
 #if defined(_MSC_VER)
 #include "pstdint.h" /* VS2008 and older */
 #else
-#include <stdint.h>
+#include <stdint.h>
 #endif
 
 
 /* symbol renaming */
 #define AES_set_encrypt_key hc_AES_set_encrypt_key
 #define AES_set_decrypt_key hc_AES_decrypt_key
+#define AES_derive_decrypt_key hc_AES_derive_decrypt_key
 #define AES_encrypt hc_AES_encrypt
 #define AES_decrypt hc_AES_decrypt
 #define AES_cbc_encrypt hc_AES_cbc_encrypt
 #define AES_cfb8_encrypt hc_AES_cfb8_encrypt
+#define AES_cfb128_encrypt hc_AES_cfb128_encrypt
+#define AES_ofb128_encrypt hc_AES_ofb128_encrypt
+#define AES_encrypt_blocks hc_AES_encrypt_blocks
+#define AES_set_dual_key hc_AES_set_dual_key
+#define AES_dual_prepare_decrypt hc_AES_dual_prepare_decrypt
+#define AES_dual_encrypt hc_AES_dual_encrypt
+#define AES_dual_decrypt hc_AES_dual_decrypt
+#define AES_dual_cbc_encrypt hc_AES_dual_cbc_encrypt
 
 /*
  *
@@ -67,22 +76,63 @@ typedef struct aes_key {
     int rounds;
 } AES_KEY;
 
+#if defined(_MSC_VER)
+#define AES_CACHELINE_ALIGN __declspec(align(64))
+#else
+#define AES_CACHELINE_ALIGN __attribute__((aligned(64)))
+#endif
+
+/*
+ * Key usable in both directions. The user key is expanded once; the
+ * decryption schedule is derived from the encryption schedule on the
+ * first decryption.
+ *
+ * The header takes 16 bytes, so with the struct on a cache line
+ * boundary every round key sits within a single line. Heap copies need
+ * an aligned allocator to keep that property.
+ */
+typedef struct AES_CACHELINE_ALIGN aes_dual_key {
+    int rounds;
+    int dec_ready;
+    uint32_t pad_[2];
+    uint32_t enc[(AES_MAXNR+1)*4];
+    uint32_t dec[(AES_MAXNR+1)*4];
+} AES_DUAL_KEY;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 int AES_set_encrypt_key(const unsigned char *, const int, AES_KEY *);
 int AES_set_decrypt_key(const unsigned char *, const int, AES_KEY *);
+void AES_derive_decrypt_key(const AES_KEY *, AES_KEY *);
 
 void AES_encrypt(const unsigned char *, unsigned char *, const AES_KEY *);
 void AES_decrypt(const unsigned char *, unsigned char *, const AES_KEY *);
 
+void AES_encrypt_blocks(const unsigned char *, unsigned char *,
+             unsigned long, const AES_KEY *);
+
+int AES_set_dual_key(const unsigned char *, const int, AES_DUAL_KEY *);
+void AES_dual_prepare_decrypt(AES_DUAL_KEY *);
+void AES_dual_encrypt(const unsigned char *, unsigned char *, const AES_DUAL_KEY *);
+void AES_dual_decrypt(const unsigned char *, unsigned char *, AES_DUAL_KEY *);
+
 void AES_cbc_encrypt(const unsigned char *, unsigned char *,
              unsigned long, const AES_KEY *,
              unsigned char *, int);
+void AES_dual_cbc_encrypt(const unsigned char *, unsigned char *,
+             unsigned long, AES_DUAL_KEY *,
+             unsigned char *, int);
 void AES_cfb8_encrypt(const unsigned char *, unsigned char *,
               unsigned long, const AES_KEY *,
               unsigned char *, int);
+void AES_cfb128_encrypt(const unsigned char *, unsigned char *,
+              unsigned long, const AES_KEY *,
+              unsigned char *, int *, int);
+void AES_ofb128_encrypt(const unsigned char *, unsigned char *,
+              unsigned long, const AES_KEY *,
+              unsigned char *, int *);
 
 void
 AES_Encrypt_CFB8_NoPadding(const unsigned char *in, unsigned char *out,
@@ -94,6 +144,21 @@ AES_Decrypt_CFB8_NoPadding(const unsigned char *in, unsigned char *out,
                  unsigned long size, const AES_KEY *key,
                  const unsigned char *iv);
 
+void
+AES_Encrypt_CFB128_NoPadding(const unsigned char *in, unsigned char *out,
+                 unsigned long size, const AES_KEY *key,
+                 const unsigned char *iv);
+
+void
+AES_Decrypt_CFB128_NoPadding(const unsigned char *in, unsigned char *out,
+                 unsigned long size, const AES_KEY *key,
+                 const unsigned char *iv);
+
+void
+AES_Crypt_OFB_NoPadding(const unsigned char *in, unsigned char *out,
+                 unsigned long size, const AES_KEY *key,
+                 const unsigned char *iv);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,509 @@
+/*
+ * calphabet.c - base64 alphabets shared by the encoder and decoder
+ *
+ * The tables of the predefined alphabets are what base64_alphabet_init()
+ * produces for their characters, written out so that they can be const
+ * and need no initialisation.
+ *
+ * The vector decoder constants follow Mula/Lemire: a character is valid
+ * if the class bits looked up by its low and high nibble do not
+ * intersect, and its value is the character plus an offset picked by the
+ * high nibble, with one character per alphabet redirected to a spare
+ * offset.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#include <string.h>
+
+#include "calphabet.h"
+
+/* RFC 4648 section 4 */
+const base64_alphabet base64_alphabet_standard =
+{
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+        "AAABACADAEAFAGAHAIAJAKALAMANAOAPAQARASATAUAVAWAXAYAZAaAbAcAdAeAfAgAhAiAjAkAlAmAnAoApAqArAsAtAuAvAwAxAyAzA0A1A2A3A4A5A6A7A8A9A+A/"
+        "BABBBCBDBEBFBGBHBIBJBKBLBMBNBOBPBQBRBSBTBUBVBWBXBYBZBaBbBcBdBeBfBgBhBiBjBkBlBmBnBoBpBqBrBsBtBuBvBwBxByBzB0B1B2B3B4B5B6B7B8B9B+B/"
+        "CACBCCCDCECFCGCHCICJCKCLCMCNCOCPCQCRCSCTCUCVCWCXCYCZCaCbCcCdCeCfCgChCiCjCkClCmCnCoCpCqCrCsCtCuCvCwCxCyCzC0C1C2C3C4C5C6C7C8C9C+C/"
+        "DADBDCDDDEDFDGDHDIDJDKDLDMDNDODPDQDRDSDTDUDVDWDXDYDZDaDbDcDdDeDfDgDhDiDjDkDlDmDnDoDpDqDrDsDtDuDvDwDxDyDzD0D1D2D3D4D5D6D7D8D9D+D/"
+        "EAEBECEDEEEFEGEHEIEJEKELEMENEOEPEQERESETEUEVEWEXEYEZEaEbEcEdEeEfEgEhEiEjEkElEmEnEoEpEqErEsEtEuEvEwExEyEzE0E1E2E3E4E5E6E7E8E9E+E/"
+        "FAFBFCFDFEFFFGFHFIFJFKFLFMFNFOFPFQFRFSFTFUFVFWFXFYFZFaFbFcFdFeFfFgFhFiFjFkFlFmFnFoFpFqFrFsFtFuFvFwFxFyFzF0F1F2F3F4F5F6F7F8F9F+F/"
+        "GAGBGCGDGEGFGGGHGIGJGKGLGMGNGOGPGQGRGSGTGUGVGWGXGYGZGaGbGcGdGeGfGgGhGiGjGkGlGmGnGoGpGqGrGsGtGuGvGwGxGyGzG0G1G2G3G4G5G6G7G8G9G+G/"
+        "HAHBHCHDHEHFHGHHHIHJHKHLHMHNHOHPHQHRHSHTHUHVHWHXHYHZHaHbHcHdHeHfHgHhHiHjHkHlHmHnHoHpHqHrHsHtHuHvHwHxHyHzH0H1H2H3H4H5H6H7H8H9H+H/"
+        "IAIBICIDIEIFIGIHIIIJIKILIMINIOIPIQIRISITIUIVIWIXIYIZIaIbIcIdIeIfIgIhIiIjIkIlImInIoIpIqIrIsItIuIvIwIxIyIzI0I1I2I3I4I5I6I7I8I9I+I/"
+        "JAJBJCJDJEJFJGJHJIJJJKJLJMJNJOJPJQJRJSJTJUJVJWJXJYJZJaJbJcJdJeJfJgJhJiJjJkJlJmJnJoJpJqJrJsJtJuJvJwJxJyJzJ0J1J2J3J4J5J6J7J8J9J+J/"
+        "KAKBKCKDKEKFKGKHKIKJKKKLKMKNKOKPKQKRKSKTKUKVKWKXKYKZKaKbKcKdKeKfKgKhKiKjKkKlKmKnKoKpKqKrKsKtKuKvKwKxKyKzK0K1K2K3K4K5K6K7K8K9K+K/"
+        "LALBLCLDLELFLGLHLILJLKLLLMLNLOLPLQLRLSLTLULVLWLXLYLZLaLbLcLdLeLfLgLhLiLjLkLlLmLnLoLpLqLrLsLtLuLvLwLxLyLzL0L1L2L3L4L5L6L7L8L9L+L/"
+        "MAMBMCMDMEMFMGMHMIMJMKMLMMMNMOMPMQMRMSMTMUMVMWMXMYMZMaMbMcMdMeMfMgMhMiMjMkMlMmMnMoMpMqMrMsMtMuMvMwMxMyMzM0M1M2M3M4M5M6M7M8M9M+M/"
+        "NANBNCNDNENFNGNHNINJNKNLNMNNNONPNQNRNSNTNUNVNWNXNYNZNaNbNcNdNeNfNgNhNiNjNkNlNmNnNoNpNqNrNsNtNuNvNwNxNyNzN0N1N2N3N4N5N6N7N8N9N+N/"
+        "OAOBOCODOEOFOGOHOIOJOKOLOMONOOOPOQOROSOTOUOVOWOXOYOZOaObOcOdOeOfOgOhOiOjOkOlOmOnOoOpOqOrOsOtOuOvOwOxOyOzO0O1O2O3O4O5O6O7O8O9O+O/"
+        "PAPBPCPDPEPFPGPHPIPJPKPLPMPNPOPPPQPRPSPTPUPVPWPXPYPZPaPbPcPdPePfPgPhPiPjPkPlPmPnPoPpPqPrPsPtPuPvPwPxPyPzP0P1P2P3P4P5P6P7P8P9P+P/"
+        "QAQBQCQDQEQFQGQHQIQJQKQLQMQNQOQPQQQRQSQTQUQVQWQXQYQZQaQbQcQdQeQfQgQhQiQjQkQlQmQnQoQpQqQrQsQtQuQvQwQxQyQzQ0Q1Q2Q3Q4Q5Q6Q7Q8Q9Q+Q/"
+        "RARBRCRDRERFRGRHRIRJRKRLRMRNRORPRQRRRSRTRURVRWRXRYRZRaRbRcRdReRfRgRhRiRjRkRlRmRnRoRpRqRrRsRtRuRvRwRxRyRzR0R1R2R3R4R5R6R7R8R9R+R/"
+        "SASBSCSDSESFSGSHSISJSKSLSMSNSOSPSQSRSSSTSUSVSWSXSYSZSaSbScSdSeSfSgShSiSjSkSlSmSnSoSpSqSrSsStSuSvSwSxSySzS0S1S2S3S4S5S6S7S8S9S+S/"
+        "TATBTCTDTETFTGTHTITJTKTLTMTNTOTPTQTRTSTTTUTVTWTXTYTZTaTbTcTdTeTfTgThTiTjTkTlTmTnToTpTqTrTsTtTuTvTwTxTyTzT0T1T2T3T4T5T6T7T8T9T+T/"
+        "UAUBUCUDUEUFUGUHUIUJUKULUMUNUOUPUQURUSUTUUUVUWUXUYUZUaUbUcUdUeUfUgUhUiUjUkUlUmUnUoUpUqUrUsUtUuUvUwUxUyUzU0U1U2U3U4U5U6U7U8U9U+U/"
+        "VAVBVCVDVEVFVGVHVIVJVKVLVMVNVOVPVQVRVSVTVUVVVWVXVYVZVaVbVcVdVeVfVgVhViVjVkVlVmVnVoVpVqVrVsVtVuVvVwVxVyVzV0V1V2V3V4V5V6V7V8V9V+V/"
+        "WAWBWCWDWEWFWGWHWIWJWKWLWMWNWOWPWQWRWSWTWUWVWWWXWYWZWaWbWcWdWeWfWgWhWiWjWkWlWmWnWoWpWqWrWsWtWuWvWwWxWyWzW0W1W2W3W4W5W6W7W8W9W+W/"
+        "XAXBXCXDXEXFXGXHXIXJXKXLXMXNXOXPXQXRXSXTXUXVXWXXXYXZXaXbXcXdXeXfXgXhXiXjXkXlXmXnXoXpXqXrXsXtXuXvXwXxXyXzX0X1X2X3X4X5X6X7X8X9X+X/"
+        "YAYBYCYDYEYFYGYHYIYJYKYLYMYNYOYPYQYRYSYTYUYVYWYXYYYZYaYbYcYdYeYfYgYhYiYjYkYlYmYnYoYpYqYrYsYtYuYvYwYxYyYzY0Y1Y2Y3Y4Y5Y6Y7Y8Y9Y+Y/"
+        "ZAZBZCZDZEZFZGZHZIZJZKZLZMZNZOZPZQZRZSZTZUZVZWZXZYZZZaZbZcZdZeZfZgZhZiZjZkZlZmZnZoZpZqZrZsZtZuZvZwZxZyZzZ0Z1Z2Z3Z4Z5Z6Z7Z8Z9Z+Z/"
+        "aAaBaCaDaEaFaGaHaIaJaKaLaMaNaOaPaQaRaSaTaUaVaWaXaYaZaaabacadaeafagahaiajakalamanaoapaqarasatauavawaxayaza0a1a2a3a4a5a6a7a8a9a+a/"
+        "bAbBbCbDbEbFbGbHbIbJbKbLbMbNbObPbQbRbSbTbUbVbWbXbYbZbabbbcbdbebfbgbhbibjbkblbmbnbobpbqbrbsbtbubvbwbxbybzb0b1b2b3b4b5b6b7b8b9b+b/"
+        "cAcBcCcDcEcFcGcHcIcJcKcLcMcNcOcPcQcRcScTcUcVcWcXcYcZcacbcccdcecfcgchcicjckclcmcncocpcqcrcsctcucvcwcxcyczc0c1c2c3c4c5c6c7c8c9c+c/"
+        "dAdBdCdDdEdFdGdHdIdJdKdLdMdNdOdPdQdRdSdTdUdVdWdXdYdZdadbdcdddedfdgdhdidjdkdldmdndodpdqdrdsdtdudvdwdxdydzd0d1d2d3d4d5d6d7d8d9d+d/"
+        "eAeBeCeDeEeFeGeHeIeJeKeLeMeNeOePeQeReSeTeUeVeWeXeYeZeaebecedeeefegeheiejekelemeneoepeqereseteuevewexeyeze0e1e2e3e4e5e6e7e8e9e+e/"
+        "fAfBfCfDfEfFfGfHfIfJfKfLfMfNfOfPfQfRfSfTfUfVfWfXfYfZfafbfcfdfefffgfhfifjfkflfmfnfofpfqfrfsftfufvfwfxfyfzf0f1f2f3f4f5f6f7f8f9f+f/"
+        "gAgBgCgDgEgFgGgHgIgJgKgLgMgNgOgPgQgRgSgTgUgVgWgXgYgZgagbgcgdgegfggghgigjgkglgmgngogpgqgrgsgtgugvgwgxgygzg0g1g2g3g4g5g6g7g8g9g+g/"
+        "hAhBhChDhEhFhGhHhIhJhKhLhMhNhOhPhQhRhShThUhVhWhXhYhZhahbhchdhehfhghhhihjhkhlhmhnhohphqhrhshthuhvhwhxhyhzh0h1h2h3h4h5h6h7h8h9h+h/"
+        "iAiBiCiDiEiFiGiHiIiJiKiLiMiNiOiPiQiRiSiTiUiViWiXiYiZiaibicidieifigihiiijikiliminioipiqirisitiuiviwixiyizi0i1i2i3i4i5i6i7i8i9i+i/"
+        "jAjBjCjDjEjFjGjHjIjJjKjLjMjNjOjPjQjRjSjTjUjVjWjXjYjZjajbjcjdjejfjgjhjijjjkjljmjnjojpjqjrjsjtjujvjwjxjyjzj0j1j2j3j4j5j6j7j8j9j+j/"
+        "kAkBkCkDkEkFkGkHkIkJkKkLkMkNkOkPkQkRkSkTkUkVkWkXkYkZkakbkckdkekfkgkhkikjkkklkmknkokpkqkrksktkukvkwkxkykzk0k1k2k3k4k5k6k7k8k9k+k/"
+        "lAlBlClDlElFlGlHlIlJlKlLlMlNlOlPlQlRlSlTlUlVlWlXlYlZlalblcldlelflglhliljlklllmlnlolplqlrlsltlulvlwlxlylzl0l1l2l3l4l5l6l7l8l9l+l/"
+        "mAmBmCmDmEmFmGmHmImJmKmLmMmNmOmPmQmRmSmTmUmVmWmXmYmZmambmcmdmemfmgmhmimjmkmlmmmnmompmqmrmsmtmumvmwmxmymzm0m1m2m3m4m5m6m7m8m9m+m/"
+        "nAnBnCnDnEnFnGnHnInJnKnLnMnNnOnPnQnRnSnTnUnVnWnXnYnZnanbncndnenfngnhninjnknlnmnnnonpnqnrnsntnunvnwnxnynzn0n1n2n3n4n5n6n7n8n9n+n/"
+        "oAoBoCoDoEoFoGoHoIoJoKoLoMoNoOoPoQoRoSoToUoVoWoXoYoZoaobocodoeofogohoiojokolomonooopoqorosotouovowoxoyozo0o1o2o3o4o5o6o7o8o9o+o/"
+        "pApBpCpDpEpFpGpHpIpJpKpLpMpNpOpPpQpRpSpTpUpVpWpXpYpZpapbpcpdpepfpgphpipjpkplpmpnpopppqprpsptpupvpwpxpypzp0p1p2p3p4p5p6p7p8p9p+p/"
+        "qAqBqCqDqEqFqGqHqIqJqKqLqMqNqOqPqQqRqSqTqUqVqWqXqYqZqaqbqcqdqeqfqgqhqiqjqkqlqmqnqoqpqqqrqsqtquqvqwqxqyqzq0q1q2q3q4q5q6q7q8q9q+q/"
+        "rArBrCrDrErFrGrHrIrJrKrLrMrNrOrPrQrRrSrTrUrVrWrXrYrZrarbrcrdrerfrgrhrirjrkrlrmrnrorprqrrrsrtrurvrwrxryrzr0r1r2r3r4r5r6r7r8r9r+r/"
+        "sAsBsCsDsEsFsGsHsIsJsKsLsMsNsOsPsQsRsSsTsUsVsWsXsYsZsasbscsdsesfsgshsisjskslsmsnsospsqsrssstsusvswsxsyszs0s1s2s3s4s5s6s7s8s9s+s/"
+        "tAtBtCtDtEtFtGtHtItJtKtLtMtNtOtPtQtRtStTtUtVtWtXtYtZtatbtctdtetftgthtitjtktltmtntotptqtrtstttutvtwtxtytzt0t1t2t3t4t5t6t7t8t9t+t/"
+        "uAuBuCuDuEuFuGuHuIuJuKuLuMuNuOuPuQuRuSuTuUuVuWuXuYuZuaubucudueufuguhuiujukulumunuoupuqurusutuuuvuwuxuyuzu0u1u2u3u4u5u6u7u8u9u+u/"
+        "vAvBvCvDvEvFvGvHvIvJvKvLvMvNvOvPvQvRvSvTvUvVvWvXvYvZvavbvcvdvevfvgvhvivjvkvlvmvnvovpvqvrvsvtvuvvvwvxvyvzv0v1v2v3v4v5v6v7v8v9v+v/"
+        "wAwBwCwDwEwFwGwHwIwJwKwLwMwNwOwPwQwRwSwTwUwVwWwXwYwZwawbwcwdwewfwgwhwiwjwkwlwmwnwowpwqwrwswtwuwvwwwxwywzw0w1w2w3w4w5w6w7w8w9w+w/"
+        "xAxBxCxDxExFxGxHxIxJxKxLxMxNxOxPxQxRxSxTxUxVxWxXxYxZxaxbxcxdxexfxgxhxixjxkxlxmxnxoxpxqxrxsxtxuxvxwxxxyxzx0x1x2x3x4x5x6x7x8x9x+x/"
+        "yAyByCyDyEyFyGyHyIyJyKyLyMyNyOyPyQyRySyTyUyVyWyXyYyZyaybycydyeyfygyhyiyjykylymynyoypyqyrysytyuyvywyxyyyzy0y1y2y3y4y5y6y7y8y9y+y/"
+        "zAzBzCzDzEzFzGzHzIzJzKzLzMzNzOzPzQzRzSzTzUzVzWzXzYzZzazbzczdzezfzgzhzizjzkzlzmznzozpzqzrzsztzuzvzwzxzyzzz0z1z2z3z4z5z6z7z8z9z+z/"
+        "0A0B0C0D0E0F0G0H0I0J0K0L0M0N0O0P0Q0R0S0T0U0V0W0X0Y0Z0a0b0c0d0e0f0g0h0i0j0k0l0m0n0o0p0q0r0s0t0u0v0w0x0y0z000102030405060708090+0/"
+        "1A1B1C1D1E1F1G1H1I1J1K1L1M1N1O1P1Q1R1S1T1U1V1W1X1Y1Z1a1b1c1d1e1f1g1h1i1j1k1l1m1n1o1p1q1r1s1t1u1v1w1x1y1z101112131415161718191+1/"
+        "2A2B2C2D2E2F2G2H2I2J2K2L2M2N2O2P2Q2R2S2T2U2V2W2X2Y2Z2a2b2c2d2e2f2g2h2i2j2k2l2m2n2o2p2q2r2s2t2u2v2w2x2y2z202122232425262728292+2/"
+        "3A3B3C3D3E3F3G3H3I3J3K3L3M3N3O3P3Q3R3S3T3U3V3W3X3Y3Z3a3b3c3d3e3f3g3h3i3j3k3l3m3n3o3p3q3r3s3t3u3v3w3x3y3z303132333435363738393+3/"
+        "4A4B4C4D4E4F4G4H4I4J4K4L4M4N4O4P4Q4R4S4T4U4V4W4X4Y4Z4a4b4c4d4e4f4g4h4i4j4k4l4m4n4o4p4q4r4s4t4u4v4w4x4y4z404142434445464748494+4/"
+        "5A5B5C5D5E5F5G5H5I5J5K5L5M5N5O5P5Q5R5S5T5U5V5W5X5Y5Z5a5b5c5d5e5f5g5h5i5j5k5l5m5n5o5p5q5r5s5t5u5v5w5x5y5z505152535455565758595+5/"
+        "6A6B6C6D6E6F6G6H6I6J6K6L6M6N6O6P6Q6R6S6T6U6V6W6X6Y6Z6a6b6c6d6e6f6g6h6i6j6k6l6m6n6o6p6q6r6s6t6u6v6w6x6y6z606162636465666768696+6/"
+        "7A7B7C7D7E7F7G7H7I7J7K7L7M7N7O7P7Q7R7S7T7U7V7W7X7Y7Z7a7b7c7d7e7f7g7h7i7j7k7l7m7n7o7p7q7r7s7t7u7v7w7x7y7z707172737475767778797+7/"
+        "8A8B8C8D8E8F8G8H8I8J8K8L8M8N8O8P8Q8R8S8T8U8V8W8X8Y8Z8a8b8c8d8e8f8g8h8i8j8k8l8m8n8o8p8q8r8s8t8u8v8w8x8y8z808182838485868788898+8/"
+        "9A9B9C9D9E9F9G9H9I9J9K9L9M9N9O9P9Q9R9S9T9U9V9W9X9Y9Z9a9b9c9d9e9f9g9h9i9j9k9l9m9n9o9p9q9r9s9t9u9v9w9x9y9z909192939495969798999+9/"
+        "+A+B+C+D+E+F+G+H+I+J+K+L+M+N+O+P+Q+R+S+T+U+V+W+X+Y+Z+a+b+c+d+e+f+g+h+i+j+k+l+m+n+o+p+q+r+s+t+u+v+w+x+y+z+0+1+2+3+4+5+6+7+8+9+++/"
+        "/A/B/C/D/E/F/G/H/I/J/K/L/M/N/O/P/Q/R/S/T/U/V/W/X/Y/Z/a/b/c/d/e/f/g/h/i/j/k/l/m/n/o/p/q/r/s/t/u/v/w/x/y/z/0/1/2/3/4/5/6/7/8/9/+//",
+    {
+        {
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x00f80000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x00fc0000,
+            0x00d00000, 0x00d40000, 0x00d80000, 0x00dc0000, 0x00e00000, 0x00e40000, 0x00e80000, 0x00ec0000,
+            0x00f00000, 0x00f40000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00000000, 0x00040000, 0x00080000, 0x000c0000, 0x00100000, 0x00140000, 0x00180000,
+            0x001c0000, 0x00200000, 0x00240000, 0x00280000, 0x002c0000, 0x00300000, 0x00340000, 0x00380000,
+            0x003c0000, 0x00400000, 0x00440000, 0x00480000, 0x004c0000, 0x00500000, 0x00540000, 0x00580000,
+            0x005c0000, 0x00600000, 0x00640000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00680000, 0x006c0000, 0x00700000, 0x00740000, 0x00780000, 0x007c0000, 0x00800000,
+            0x00840000, 0x00880000, 0x008c0000, 0x00900000, 0x00940000, 0x00980000, 0x009c0000, 0x00a00000,
+            0x00a40000, 0x00a80000, 0x00ac0000, 0x00b00000, 0x00b40000, 0x00b80000, 0x00bc0000, 0x00c00000,
+            0x00c40000, 0x00c80000, 0x00cc0000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR
+        },
+        {
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x0003e000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x0003f000,
+            0x00034000, 0x00035000, 0x00036000, 0x00037000, 0x00038000, 0x00039000, 0x0003a000, 0x0003b000,
+            0x0003c000, 0x0003d000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000,
+            0x00007000, 0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000,
+            0x0000f000, 0x00010000, 0x00011000, 0x00012000, 0x00013000, 0x00014000, 0x00015000, 0x00016000,
+            0x00017000, 0x00018000, 0x00019000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x0001a000, 0x0001b000, 0x0001c000, 0x0001d000, 0x0001e000, 0x0001f000, 0x00020000,
+            0x00021000, 0x00022000, 0x00023000, 0x00024000, 0x00025000, 0x00026000, 0x00027000, 0x00028000,
+            0x00029000, 0x0002a000, 0x0002b000, 0x0002c000, 0x0002d000, 0x0002e000, 0x0002f000, 0x00030000,
+            0x00031000, 0x00032000, 0x00033000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR
+        },
+        {
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x00000f80, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x00000fc0,
+            0x00000d00, 0x00000d40, 0x00000d80, 0x00000dc0, 0x00000e00, 0x00000e40, 0x00000e80, 0x00000ec0,
+            0x00000f00, 0x00000f40, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180,
+            0x000001c0, 0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380,
+            0x000003c0, 0x00000400, 0x00000440, 0x00000480, 0x000004c0, 0x00000500, 0x00000540, 0x00000580,
+            0x000005c0, 0x00000600, 0x00000640, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00000680, 0x000006c0, 0x00000700, 0x00000740, 0x00000780, 0x000007c0, 0x00000800,
+            0x00000840, 0x00000880, 0x000008c0, 0x00000900, 0x00000940, 0x00000980, 0x000009c0, 0x00000a00,
+            0x00000a40, 0x00000a80, 0x00000ac0, 0x00000b00, 0x00000b40, 0x00000b80, 0x00000bc0, 0x00000c00,
+            0x00000c40, 0x00000c80, 0x00000cc0, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR
+        },
+        {
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x0000003e, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x0000003f,
+            0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038, 0x00000039, 0x0000003a, 0x0000003b,
+            0x0000003c, 0x0000003d, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006,
+            0x00000007, 0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e,
+            0x0000000f, 0x00000010, 0x00000011, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016,
+            0x00000017, 0x00000018, 0x00000019, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x0000001a, 0x0000001b, 0x0000001c, 0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+            0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000028,
+            0x00000029, 0x0000002a, 0x0000002b, 0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+            0x00000031, 0x00000032, 0x00000033, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR
+        }
+    },
+    1,
+    { 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 65, 0, 0 },
+    1,
+    { 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x3a, 0x3b, 0x3b, 0x3b, 0x3a },
+    { 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+    { 0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0 },
+    '/', -1
+};
+
+/* RFC 4648 section 5, URL and filename safe */
+const base64_alphabet base64_alphabet_url =
+{
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+        "AAABACADAEAFAGAHAIAJAKALAMANAOAPAQARASATAUAVAWAXAYAZAaAbAcAdAeAfAgAhAiAjAkAlAmAnAoApAqArAsAtAuAvAwAxAyAzA0A1A2A3A4A5A6A7A8A9A-A_"
+        "BABBBCBDBEBFBGBHBIBJBKBLBMBNBOBPBQBRBSBTBUBVBWBXBYBZBaBbBcBdBeBfBgBhBiBjBkBlBmBnBoBpBqBrBsBtBuBvBwBxByBzB0B1B2B3B4B5B6B7B8B9B-B_"
+        "CACBCCCDCECFCGCHCICJCKCLCMCNCOCPCQCRCSCTCUCVCWCXCYCZCaCbCcCdCeCfCgChCiCjCkClCmCnCoCpCqCrCsCtCuCvCwCxCyCzC0C1C2C3C4C5C6C7C8C9C-C_"
+        "DADBDCDDDEDFDGDHDIDJDKDLDMDNDODPDQDRDSDTDUDVDWDXDYDZDaDbDcDdDeDfDgDhDiDjDkDlDmDnDoDpDqDrDsDtDuDvDwDxDyDzD0D1D2D3D4D5D6D7D8D9D-D_"
+        "EAEBECEDEEEFEGEHEIEJEKELEMENEOEPEQERESETEUEVEWEXEYEZEaEbEcEdEeEfEgEhEiEjEkElEmEnEoEpEqErEsEtEuEvEwExEyEzE0E1E2E3E4E5E6E7E8E9E-E_"
+        "FAFBFCFDFEFFFGFHFIFJFKFLFMFNFOFPFQFRFSFTFUFVFWFXFYFZFaFbFcFdFeFfFgFhFiFjFkFlFmFnFoFpFqFrFsFtFuFvFwFxFyFzF0F1F2F3F4F5F6F7F8F9F-F_"
+        "GAGBGCGDGEGFGGGHGIGJGKGLGMGNGOGPGQGRGSGTGUGVGWGXGYGZGaGbGcGdGeGfGgGhGiGjGkGlGmGnGoGpGqGrGsGtGuGvGwGxGyGzG0G1G2G3G4G5G6G7G8G9G-G_"
+        "HAHBHCHDHEHFHGHHHIHJHKHLHMHNHOHPHQHRHSHTHUHVHWHXHYHZHaHbHcHdHeHfHgHhHiHjHkHlHmHnHoHpHqHrHsHtHuHvHwHxHyHzH0H1H2H3H4H5H6H7H8H9H-H_"
+        "IAIBICIDIEIFIGIHIIIJIKILIMINIOIPIQIRISITIUIVIWIXIYIZIaIbIcIdIeIfIgIhIiIjIkIlImInIoIpIqIrIsItIuIvIwIxIyIzI0I1I2I3I4I5I6I7I8I9I-I_"
+        "JAJBJCJDJEJFJGJHJIJJJKJLJMJNJOJPJQJRJSJTJUJVJWJXJYJZJaJbJcJdJeJfJgJhJiJjJkJlJmJnJoJpJqJrJsJtJuJvJwJxJyJzJ0J1J2J3J4J5J6J7J8J9J-J_"
+        "KAKBKCKDKEKFKGKHKIKJKKKLKMKNKOKPKQKRKSKTKUKVKWKXKYKZKaKbKcKdKeKfKgKhKiKjKkKlKmKnKoKpKqKrKsKtKuKvKwKxKyKzK0K1K2K3K4K5K6K7K8K9K-K_"
+        "LALBLCLDLELFLGLHLILJLKLLLMLNLOLPLQLRLSLTLULVLWLXLYLZLaLbLcLdLeLfLgLhLiLjLkLlLmLnLoLpLqLrLsLtLuLvLwLxLyLzL0L1L2L3L4L5L6L7L8L9L-L_"
+        "MAMBMCMDMEMFMGMHMIMJMKMLMMMNMOMPMQMRMSMTMUMVMWMXMYMZMaMbMcMdMeMfMgMhMiMjMkMlMmMnMoMpMqMrMsMtMuMvMwMxMyMzM0M1M2M3M4M5M6M7M8M9M-M_"
+        "NANBNCNDNENFNGNHNINJNKNLNMNNNONPNQNRNSNTNUNVNWNXNYNZNaNbNcNdNeNfNgNhNiNjNkNlNmNnNoNpNqNrNsNtNuNvNwNxNyNzN0N1N2N3N4N5N6N7N8N9N-N_"
+        "OAOBOCODOEOFOGOHOIOJOKOLOMONOOOPOQOROSOTOUOVOWOXOYOZOaObOcOdOeOfOgOhOiOjOkOlOmOnOoOpOqOrOsOtOuOvOwOxOyOzO0O1O2O3O4O5O6O7O8O9O-O_"
+        "PAPBPCPDPEPFPGPHPIPJPKPLPMPNPOPPPQPRPSPTPUPVPWPXPYPZPaPbPcPdPePfPgPhPiPjPkPlPmPnPoPpPqPrPsPtPuPvPwPxPyPzP0P1P2P3P4P5P6P7P8P9P-P_"
+        "QAQBQCQDQEQFQGQHQIQJQKQLQMQNQOQPQQQRQSQTQUQVQWQXQYQZQaQbQcQdQeQfQgQhQiQjQkQlQmQnQoQpQqQrQsQtQuQvQwQxQyQzQ0Q1Q2Q3Q4Q5Q6Q7Q8Q9Q-Q_"
+        "RARBRCRDRERFRGRHRIRJRKRLRMRNRORPRQRRRSRTRURVRWRXRYRZRaRbRcRdReRfRgRhRiRjRkRlRmRnRoRpRqRrRsRtRuRvRwRxRyRzR0R1R2R3R4R5R6R7R8R9R-R_"
+        "SASBSCSDSESFSGSHSISJSKSLSMSNSOSPSQSRSSSTSUSVSWSXSYSZSaSbScSdSeSfSgShSiSjSkSlSmSnSoSpSqSrSsStSuSvSwSxSySzS0S1S2S3S4S5S6S7S8S9S-S_"
+        "TATBTCTDTETFTGTHTITJTKTLTMTNTOTPTQTRTSTTTUTVTWTXTYTZTaTbTcTdTeTfTgThTiTjTkTlTmTnToTpTqTrTsTtTuTvTwTxTyTzT0T1T2T3T4T5T6T7T8T9T-T_"
+        "UAUBUCUDUEUFUGUHUIUJUKULUMUNUOUPUQURUSUTUUUVUWUXUYUZUaUbUcUdUeUfUgUhUiUjUkUlUmUnUoUpUqUrUsUtUuUvUwUxUyUzU0U1U2U3U4U5U6U7U8U9U-U_"
+        "VAVBVCVDVEVFVGVHVIVJVKVLVMVNVOVPVQVRVSVTVUVVVWVXVYVZVaVbVcVdVeVfVgVhViVjVkVlVmVnVoVpVqVrVsVtVuVvVwVxVyVzV0V1V2V3V4V5V6V7V8V9V-V_"
+        "WAWBWCWDWEWFWGWHWIWJWKWLWMWNWOWPWQWRWSWTWUWVWWWXWYWZWaWbWcWdWeWfWgWhWiWjWkWlWmWnWoWpWqWrWsWtWuWvWwWxWyWzW0W1W2W3W4W5W6W7W8W9W-W_"
+        "XAXBXCXDXEXFXGXHXIXJXKXLXMXNXOXPXQXRXSXTXUXVXWXXXYXZXaXbXcXdXeXfXgXhXiXjXkXlXmXnXoXpXqXrXsXtXuXvXwXxXyXzX0X1X2X3X4X5X6X7X8X9X-X_"
+        "YAYBYCYDYEYFYGYHYIYJYKYLYMYNYOYPYQYRYSYTYUYVYWYXYYYZYaYbYcYdYeYfYgYhYiYjYkYlYmYnYoYpYqYrYsYtYuYvYwYxYyYzY0Y1Y2Y3Y4Y5Y6Y7Y8Y9Y-Y_"
+        "ZAZBZCZDZEZFZGZHZIZJZKZLZMZNZOZPZQZRZSZTZUZVZWZXZYZZZaZbZcZdZeZfZgZhZiZjZkZlZmZnZoZpZqZrZsZtZuZvZwZxZyZzZ0Z1Z2Z3Z4Z5Z6Z7Z8Z9Z-Z_"
+        "aAaBaCaDaEaFaGaHaIaJaKaLaMaNaOaPaQaRaSaTaUaVaWaXaYaZaaabacadaeafagahaiajakalamanaoapaqarasatauavawaxayaza0a1a2a3a4a5a6a7a8a9a-a_"
+        "bAbBbCbDbEbFbGbHbIbJbKbLbMbNbObPbQbRbSbTbUbVbWbXbYbZbabbbcbdbebfbgbhbibjbkblbmbnbobpbqbrbsbtbubvbwbxbybzb0b1b2b3b4b5b6b7b8b9b-b_"
+        "cAcBcCcDcEcFcGcHcIcJcKcLcMcNcOcPcQcRcScTcUcVcWcXcYcZcacbcccdcecfcgchcicjckclcmcncocpcqcrcsctcucvcwcxcyczc0c1c2c3c4c5c6c7c8c9c-c_"
+        "dAdBdCdDdEdFdGdHdIdJdKdLdMdNdOdPdQdRdSdTdUdVdWdXdYdZdadbdcdddedfdgdhdidjdkdldmdndodpdqdrdsdtdudvdwdxdydzd0d1d2d3d4d5d6d7d8d9d-d_"
+        "eAeBeCeDeEeFeGeHeIeJeKeLeMeNeOePeQeReSeTeUeVeWeXeYeZeaebecedeeefegeheiejekelemeneoepeqereseteuevewexeyeze0e1e2e3e4e5e6e7e8e9e-e_"
+        "fAfBfCfDfEfFfGfHfIfJfKfLfMfNfOfPfQfRfSfTfUfVfWfXfYfZfafbfcfdfefffgfhfifjfkflfmfnfofpfqfrfsftfufvfwfxfyfzf0f1f2f3f4f5f6f7f8f9f-f_"
+        "gAgBgCgDgEgFgGgHgIgJgKgLgMgNgOgPgQgRgSgTgUgVgWgXgYgZgagbgcgdgegfggghgigjgkglgmgngogpgqgrgsgtgugvgwgxgygzg0g1g2g3g4g5g6g7g8g9g-g_"
+        "hAhBhChDhEhFhGhHhIhJhKhLhMhNhOhPhQhRhShThUhVhWhXhYhZhahbhchdhehfhghhhihjhkhlhmhnhohphqhrhshthuhvhwhxhyhzh0h1h2h3h4h5h6h7h8h9h-h_"
+        "iAiBiCiDiEiFiGiHiIiJiKiLiMiNiOiPiQiRiSiTiUiViWiXiYiZiaibicidieifigihiiijikiliminioipiqirisitiuiviwixiyizi0i1i2i3i4i5i6i7i8i9i-i_"
+        "jAjBjCjDjEjFjGjHjIjJjKjLjMjNjOjPjQjRjSjTjUjVjWjXjYjZjajbjcjdjejfjgjhjijjjkjljmjnjojpjqjrjsjtjujvjwjxjyjzj0j1j2j3j4j5j6j7j8j9j-j_"
+        "kAkBkCkDkEkFkGkHkIkJkKkLkMkNkOkPkQkRkSkTkUkVkWkXkYkZkakbkckdkekfkgkhkikjkkklkmknkokpkqkrksktkukvkwkxkykzk0k1k2k3k4k5k6k7k8k9k-k_"
+        "lAlBlClDlElFlGlHlIlJlKlLlMlNlOlPlQlRlSlTlUlVlWlXlYlZlalblcldlelflglhliljlklllmlnlolplqlrlsltlulvlwlxlylzl0l1l2l3l4l5l6l7l8l9l-l_"
+        "mAmBmCmDmEmFmGmHmImJmKmLmMmNmOmPmQmRmSmTmUmVmWmXmYmZmambmcmdmemfmgmhmimjmkmlmmmnmompmqmrmsmtmumvmwmxmymzm0m1m2m3m4m5m6m7m8m9m-m_"
+        "nAnBnCnDnEnFnGnHnInJnKnLnMnNnOnPnQnRnSnTnUnVnWnXnYnZnanbncndnenfngnhninjnknlnmnnnonpnqnrnsntnunvnwnxnynzn0n1n2n3n4n5n6n7n8n9n-n_"
+        "oAoBoCoDoEoFoGoHoIoJoKoLoMoNoOoPoQoRoSoToUoVoWoXoYoZoaobocodoeofogohoiojokolomonooopoqorosotouovowoxoyozo0o1o2o3o4o5o6o7o8o9o-o_"
+        "pApBpCpDpEpFpGpHpIpJpKpLpMpNpOpPpQpRpSpTpUpVpWpXpYpZpapbpcpdpepfpgphpipjpkplpmpnpopppqprpsptpupvpwpxpypzp0p1p2p3p4p5p6p7p8p9p-p_"
+        "qAqBqCqDqEqFqGqHqIqJqKqLqMqNqOqPqQqRqSqTqUqVqWqXqYqZqaqbqcqdqeqfqgqhqiqjqkqlqmqnqoqpqqqrqsqtquqvqwqxqyqzq0q1q2q3q4q5q6q7q8q9q-q_"
+        "rArBrCrDrErFrGrHrIrJrKrLrMrNrOrPrQrRrSrTrUrVrWrXrYrZrarbrcrdrerfrgrhrirjrkrlrmrnrorprqrrrsrtrurvrwrxryrzr0r1r2r3r4r5r6r7r8r9r-r_"
+        "sAsBsCsDsEsFsGsHsIsJsKsLsMsNsOsPsQsRsSsTsUsVsWsXsYsZsasbscsdsesfsgshsisjskslsmsnsospsqsrssstsusvswsxsyszs0s1s2s3s4s5s6s7s8s9s-s_"
+        "tAtBtCtDtEtFtGtHtItJtKtLtMtNtOtPtQtRtStTtUtVtWtXtYtZtatbtctdtetftgthtitjtktltmtntotptqtrtstttutvtwtxtytzt0t1t2t3t4t5t6t7t8t9t-t_"
+        "uAuBuCuDuEuFuGuHuIuJuKuLuMuNuOuPuQuRuSuTuUuVuWuXuYuZuaubucudueufuguhuiujukulumunuoupuqurusutuuuvuwuxuyuzu0u1u2u3u4u5u6u7u8u9u-u_"
+        "vAvBvCvDvEvFvGvHvIvJvKvLvMvNvOvPvQvRvSvTvUvVvWvXvYvZvavbvcvdvevfvgvhvivjvkvlvmvnvovpvqvrvsvtvuvvvwvxvyvzv0v1v2v3v4v5v6v7v8v9v-v_"
+        "wAwBwCwDwEwFwGwHwIwJwKwLwMwNwOwPwQwRwSwTwUwVwWwXwYwZwawbwcwdwewfwgwhwiwjwkwlwmwnwowpwqwrwswtwuwvwwwxwywzw0w1w2w3w4w5w6w7w8w9w-w_"
+        "xAxBxCxDxExFxGxHxIxJxKxLxMxNxOxPxQxRxSxTxUxVxWxXxYxZxaxbxcxdxexfxgxhxixjxkxlxmxnxoxpxqxrxsxtxuxvxwxxxyxzx0x1x2x3x4x5x6x7x8x9x-x_"
+        "yAyByCyDyEyFyGyHyIyJyKyLyMyNyOyPyQyRySyTyUyVyWyXyYyZyaybycydyeyfygyhyiyjykylymynyoypyqyrysytyuyvywyxyyyzy0y1y2y3y4y5y6y7y8y9y-y_"
+        "zAzBzCzDzEzFzGzHzIzJzKzLzMzNzOzPzQzRzSzTzUzVzWzXzYzZzazbzczdzezfzgzhzizjzkzlzmznzozpzqzrzsztzuzvzwzxzyzzz0z1z2z3z4z5z6z7z8z9z-z_"
+        "0A0B0C0D0E0F0G0H0I0J0K0L0M0N0O0P0Q0R0S0T0U0V0W0X0Y0Z0a0b0c0d0e0f0g0h0i0j0k0l0m0n0o0p0q0r0s0t0u0v0w0x0y0z000102030405060708090-0_"
+        "1A1B1C1D1E1F1G1H1I1J1K1L1M1N1O1P1Q1R1S1T1U1V1W1X1Y1Z1a1b1c1d1e1f1g1h1i1j1k1l1m1n1o1p1q1r1s1t1u1v1w1x1y1z101112131415161718191-1_"
+        "2A2B2C2D2E2F2G2H2I2J2K2L2M2N2O2P2Q2R2S2T2U2V2W2X2Y2Z2a2b2c2d2e2f2g2h2i2j2k2l2m2n2o2p2q2r2s2t2u2v2w2x2y2z202122232425262728292-2_"
+        "3A3B3C3D3E3F3G3H3I3J3K3L3M3N3O3P3Q3R3S3T3U3V3W3X3Y3Z3a3b3c3d3e3f3g3h3i3j3k3l3m3n3o3p3q3r3s3t3u3v3w3x3y3z303132333435363738393-3_"
+        "4A4B4C4D4E4F4G4H4I4J4K4L4M4N4O4P4Q4R4S4T4U4V4W4X4Y4Z4a4b4c4d4e4f4g4h4i4j4k4l4m4n4o4p4q4r4s4t4u4v4w4x4y4z404142434445464748494-4_"
+        "5A5B5C5D5E5F5G5H5I5J5K5L5M5N5O5P5Q5R5S5T5U5V5W5X5Y5Z5a5b5c5d5e5f5g5h5i5j5k5l5m5n5o5p5q5r5s5t5u5v5w5x5y5z505152535455565758595-5_"
+        "6A6B6C6D6E6F6G6H6I6J6K6L6M6N6O6P6Q6R6S6T6U6V6W6X6Y6Z6a6b6c6d6e6f6g6h6i6j6k6l6m6n6o6p6q6r6s6t6u6v6w6x6y6z606162636465666768696-6_"
+        "7A7B7C7D7E7F7G7H7I7J7K7L7M7N7O7P7Q7R7S7T7U7V7W7X7Y7Z7a7b7c7d7e7f7g7h7i7j7k7l7m7n7o7p7q7r7s7t7u7v7w7x7y7z707172737475767778797-7_"
+        "8A8B8C8D8E8F8G8H8I8J8K8L8M8N8O8P8Q8R8S8T8U8V8W8X8Y8Z8a8b8c8d8e8f8g8h8i8j8k8l8m8n8o8p8q8r8s8t8u8v8w8x8y8z808182838485868788898-8_"
+        "9A9B9C9D9E9F9G9H9I9J9K9L9M9N9O9P9Q9R9S9T9U9V9W9X9Y9Z9a9b9c9d9e9f9g9h9i9j9k9l9m9n9o9p9q9r9s9t9u9v9w9x9y9z909192939495969798999-9_"
+        "-A-B-C-D-E-F-G-H-I-J-K-L-M-N-O-P-Q-R-S-T-U-V-W-X-Y-Z-a-b-c-d-e-f-g-h-i-j-k-l-m-n-o-p-q-r-s-t-u-v-w-x-y-z-0-1-2-3-4-5-6-7-8-9---_"
+        "_A_B_C_D_E_F_G_H_I_J_K_L_M_N_O_P_Q_R_S_T_U_V_W_X_Y_Z_a_b_c_d_e_f_g_h_i_j_k_l_m_n_o_p_q_r_s_t_u_v_w_x_y_z_0_1_2_3_4_5_6_7_8_9_-__",
+    {
+        {
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x00f80000, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            0x00d00000, 0x00d40000, 0x00d80000, 0x00dc0000, 0x00e00000, 0x00e40000, 0x00e80000, 0x00ec0000,
+            0x00f00000, 0x00f40000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00000000, 0x00040000, 0x00080000, 0x000c0000, 0x00100000, 0x00140000, 0x00180000,
+            0x001c0000, 0x00200000, 0x00240000, 0x00280000, 0x002c0000, 0x00300000, 0x00340000, 0x00380000,
+            0x003c0000, 0x00400000, 0x00440000, 0x00480000, 0x004c0000, 0x00500000, 0x00540000, 0x00580000,
+            0x005c0000, 0x00600000, 0x00640000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x00fc0000,
+            BASE64_BAD_CHAR, 0x00680000, 0x006c0000, 0x00700000, 0x00740000, 0x00780000, 0x007c0000, 0x00800000,
+            0x00840000, 0x00880000, 0x008c0000, 0x00900000, 0x00940000, 0x00980000, 0x009c0000, 0x00a00000,
+            0x00a40000, 0x00a80000, 0x00ac0000, 0x00b00000, 0x00b40000, 0x00b80000, 0x00bc0000, 0x00c00000,
+            0x00c40000, 0x00c80000, 0x00cc0000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR
+        },
+        {
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x0003e000, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            0x00034000, 0x00035000, 0x00036000, 0x00037000, 0x00038000, 0x00039000, 0x0003a000, 0x0003b000,
+            0x0003c000, 0x0003d000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00000000, 0x00001000, 0x00002000, 0x00003000, 0x00004000, 0x00005000, 0x00006000,
+            0x00007000, 0x00008000, 0x00009000, 0x0000a000, 0x0000b000, 0x0000c000, 0x0000d000, 0x0000e000,
+            0x0000f000, 0x00010000, 0x00011000, 0x00012000, 0x00013000, 0x00014000, 0x00015000, 0x00016000,
+            0x00017000, 0x00018000, 0x00019000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x0003f000,
+            BASE64_BAD_CHAR, 0x0001a000, 0x0001b000, 0x0001c000, 0x0001d000, 0x0001e000, 0x0001f000, 0x00020000,
+            0x00021000, 0x00022000, 0x00023000, 0x00024000, 0x00025000, 0x00026000, 0x00027000, 0x00028000,
+            0x00029000, 0x0002a000, 0x0002b000, 0x0002c000, 0x0002d000, 0x0002e000, 0x0002f000, 0x00030000,
+            0x00031000, 0x00032000, 0x00033000, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR
+        },
+        {
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x00000f80, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            0x00000d00, 0x00000d40, 0x00000d80, 0x00000dc0, 0x00000e00, 0x00000e40, 0x00000e80, 0x00000ec0,
+            0x00000f00, 0x00000f40, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00000000, 0x00000040, 0x00000080, 0x000000c0, 0x00000100, 0x00000140, 0x00000180,
+            0x000001c0, 0x00000200, 0x00000240, 0x00000280, 0x000002c0, 0x00000300, 0x00000340, 0x00000380,
+            0x000003c0, 0x00000400, 0x00000440, 0x00000480, 0x000004c0, 0x00000500, 0x00000540, 0x00000580,
+            0x000005c0, 0x00000600, 0x00000640, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x00000fc0,
+            BASE64_BAD_CHAR, 0x00000680, 0x000006c0, 0x00000700, 0x00000740, 0x00000780, 0x000007c0, 0x00000800,
+            0x00000840, 0x00000880, 0x000008c0, 0x00000900, 0x00000940, 0x00000980, 0x000009c0, 0x00000a00,
+            0x00000a40, 0x00000a80, 0x00000ac0, 0x00000b00, 0x00000b40, 0x00000b80, 0x00000bc0, 0x00000c00,
+            0x00000c40, 0x00000c80, 0x00000cc0, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR
+        },
+        {
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x0000003e, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            0x00000034, 0x00000035, 0x00000036, 0x00000037, 0x00000038, 0x00000039, 0x0000003a, 0x0000003b,
+            0x0000003c, 0x0000003d, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, 0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006,
+            0x00000007, 0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e,
+            0x0000000f, 0x00000010, 0x00000011, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016,
+            0x00000017, 0x00000018, 0x00000019, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, 0x0000003f,
+            BASE64_BAD_CHAR, 0x0000001a, 0x0000001b, 0x0000001c, 0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+            0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000028,
+            0x00000029, 0x0000002a, 0x0000002b, 0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+            0x00000031, 0x00000032, 0x00000033, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR,
+            BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR, BASE64_BAD_CHAR
+        }
+    },
+    1,
+    { 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -17, 32, 65, 0, 0 },
+    1,
+    { 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x3b, 0x3b, 0x3a, 0x3b, 0x33 },
+    { 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+    { -32, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0 },
+    '_', -5
+};
+
+int base64_alphabet_init(base64_alphabet* alphabet_out, const char* chars)
+{
+    static const char* const layout = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+    unsigned char seen[256];
+    int i, j;
+
+    memset(seen, 0, sizeof(seen));
+    for (i = 0; i < 64; i++)
+    {
+        const unsigned char c = (unsigned char) chars[i];
+        if (c == '\0' || c == '=' || c == ' ' || (c >= '\t' && c <= '\r') || seen[c])
+            return -1;
+        seen[c] = 1;
+    }
+
+    if (memcmp(chars, base64_alphabet_standard.chars, 64) == 0)
+    {
+        memcpy(alphabet_out, &base64_alphabet_standard, sizeof(*alphabet_out));
+        return 0;
+    }
+    if (memcmp(chars, base64_alphabet_url.chars, 64) == 0)
+    {
+        memcpy(alphabet_out, &base64_alphabet_url, sizeof(*alphabet_out));
+        return 0;
+    }
+
+    memset(alphabet_out, 0, sizeof(*alphabet_out));
+    memcpy(alphabet_out->chars, chars, 64);
+    for (i = 0; i < 64; i++)
+    {
+        for (j = 0; j < 64; j++)
+        {
+            alphabet_out->pairs[2 * (64 * i + j)] = chars[i];
+            alphabet_out->pairs[2 * (64 * i + j) + 1] = chars[j];
+        }
+    }
+    for (i = 0; i < 256; i++)
+    {
+        for (j = 0; j < 4; j++)
+            alphabet_out->decode[j][i] = BASE64_BAD_CHAR;
+    }
+    for (i = 0; i < 64; i++)
+    {
+        const unsigned char c = (unsigned char) chars[i];
+        alphabet_out->decode[0][c] = (uint32_t) i << 18;
+        alphabet_out->decode[1][c] = (uint32_t) i << 12;
+        alphabet_out->decode[2][c] = (uint32_t) i << 6;
+        alphabet_out->decode[3][c] = (uint32_t) i;
+    }
+
+    if (memcmp(chars, layout, 62) == 0)
+    {
+        memcpy(alphabet_out->enc_shift, base64_alphabet_standard.enc_shift, 16);
+        alphabet_out->enc_shift[11] = (signed char) ((unsigned char) chars[62] - 62);
+        alphabet_out->enc_shift[12] = (signed char) ((unsigned char) chars[63] - 63);
+        alphabet_out->enc_layout = 1;
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * calphabet.h - base64 alphabets shared by the encoder and decoder
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#ifndef BASE64_CALPHABET_H
+#define BASE64_CALPHABET_H
+
+#if defined(_MSC_VER)
+#include "pstdint.h" /* VS2008 and older */
+#else
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* set in every decode[] entry of a character outside the alphabet */
+#define BASE64_BAD_CHAR 0x80000000
+
+/*
+The 64 characters with the lookup tables the scalar and vector kernels
+run on. The predefined alphabets are ready to use; others are set up with
+base64_alphabet_init. Either way the object is read-only afterwards and
+can be shared between any number of states and threads.
+*/
+typedef struct
+{
+    char chars[64];
+    /* both characters of every 12 bit value */
+    char pairs[2 * 4096 + 1];
+    /* sextet value of a character at each position of a quad, pre-shifted */
+    uint32_t decode[4][256];
+    /* encoder: alphabet is A-Z a-z 0-9 and two more, offsets per range */
+    int enc_layout;
+    signed char enc_shift[16];
+    /* decoder: nibble classes and offsets for the vector kernels */
+    int dec_simd;
+    unsigned char dec_lo[16];
+    unsigned char dec_hi[16];
+    signed char dec_roll[16];
+    char dec_special;
+    signed char dec_delta;
+} base64_alphabet;
+
+/* RFC 4648 "base64", '+' and '/' */
+extern const base64_alphabet base64_alphabet_standard;
+
+/* RFC 4648 "base64url", '-' and '_' */
+extern const base64_alphabet base64_alphabet_url;
+
+/*
+Set up a custom alphabet from 64 distinct characters, none of which may
+be '=', '\0' or white space. Returns 0 on success, -1 otherwise.
+
+Encoding runs the vector kernels for any alphabet; decoding does only
+for the two standard ones and uses the scalar tables for the rest.
+*/
+int base64_alphabet_init(base64_alphabet* alphabet_out, const char* chars);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASE64_CALPHABET_H */
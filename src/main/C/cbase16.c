@@ -0,0 +1,320 @@
+/*
+ * cbase16.c - hex (RFC 4648 base16) encoding and decoding
+ *
+ * The vector encoder splits bytes into nibbles and looks the digits up
+ * with a byte shuffle; the decoder range checks digits and letters,
+ * then merges nibble pairs with a multiply-add and packs them.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#include "cbase16.h"
+#include "simd.h"
+
+static const char digits_lower[] = "0123456789abcdef";
+static const char digits_upper[] = "0123456789ABCDEF";
+
+/* digit values, -1 for anything else */
+static const signed char hex_value[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+static int is_space(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+#if defined(SIMD_SSSE3)
+/* 16 bytes to 32 digits */
+static void hex_encode16(const char* in, char* out, __m128i digits)
+{
+    const __m128i mask_0f = _mm_set1_epi8(0x0f);
+    __m128i v = _mm_loadu_si128((const __m128i*) in);
+    __m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(v, 4), mask_0f));
+    __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(v, mask_0f));
+
+    _mm_storeu_si128((__m128i*) out, _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i*) (out + 16), _mm_unpackhi_epi8(hi, lo));
+}
+
+/* digits to their values; 0 if any of the 16 characters is not a digit */
+static int hex_translate(__m128i* v)
+{
+    const __m128i d = _mm_sub_epi8(*v, _mm_set1_epi8('0'));
+    const __m128i l = _mm_sub_epi8(_mm_or_si128(*v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_d = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    const __m128i is_l = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+
+    if (_mm_movemask_epi8(_mm_or_si128(is_d, is_l)) != 0xFFFF)
+        return 0;
+    *v = _mm_or_si128(_mm_and_si128(is_d, d), _mm_and_si128(is_l, _mm_add_epi8(l, _mm_set1_epi8(10))));
+    return 1;
+}
+#endif /* SIMD_SSSE3 */
+
+#if defined(SIMD_AVX2)
+/* 32 bytes to 64 digits */
+static void hex_encode32(const char* in, char* out, __m256i digits)
+{
+    const __m256i mask_0f = _mm256_set1_epi8(0x0f);
+    __m256i v = _mm256_loadu_si256((const __m256i*) in);
+    __m256i hi = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(v, 4), mask_0f));
+    __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(v, mask_0f));
+    __m256i a = _mm256_unpacklo_epi8(hi, lo);
+    __m256i b = _mm256_unpackhi_epi8(hi, lo);
+
+    /* the unpacks work per 128 bit lane */
+    _mm256_storeu_si256((__m256i*) out, _mm256_permute2x128_si256(a, b, 0x20));
+    _mm256_storeu_si256((__m256i*) (out + 32), _mm256_permute2x128_si256(a, b, 0x31));
+}
+
+static int hex_translate_avx2(__m256i* v)
+{
+    const __m256i d = _mm256_sub_epi8(*v, _mm256_set1_epi8('0'));
+    const __m256i l = _mm256_sub_epi8(_mm256_or_si256(*v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const __m256i is_d = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+    const __m256i is_l = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+
+    if (_mm256_movemask_epi8(_mm256_or_si256(is_d, is_l)) != -1)
+        return 0;
+    *v = _mm256_or_si256(_mm256_and_si256(is_d, d),
+                         _mm256_and_si256(is_l, _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+    return 1;
+}
+#endif /* SIMD_AVX2 */
+
+void base16_init_encodestate(base16_encodestate* state_in)
+{
+    state_in->uppercase = 0;
+}
+
+void base16_encodestate_set_case(base16_encodestate* state_in, int uppercase)
+{
+    state_in->uppercase = uppercase;
+}
+
+int base16_encode_block(const char* plaintext_in, int length_in, char* code_out, base16_encodestate* state_in)
+{
+    const char* const digits = state_in->uppercase ? digits_upper : digits_lower;
+    const char* plainchar = plaintext_in;
+    char* codechar = code_out;
+
+#if defined(SIMD_SSSE3)
+    {
+        const __m128i lut = _mm_loadu_si128((const __m128i*) digits);
+#if defined(SIMD_AVX2)
+        const __m256i lut_avx2 = _mm256_broadcastsi128_si256(lut);
+
+        while (length_in >= 32)
+        {
+            hex_encode32(plainchar, codechar, lut_avx2);
+            plainchar += 32; length_in -= 32; codechar += 64;
+        }
+#endif
+        while (length_in >= 16)
+        {
+            hex_encode16(plainchar, codechar, lut);
+            plainchar += 16; length_in -= 16; codechar += 32;
+        }
+    }
+#endif
+    while (length_in-- > 0)
+    {
+        const unsigned char c = (unsigned char) *plainchar++;
+        *codechar++ = digits[c >> 4];
+        *codechar++ = digits[c & 0x0f];
+    }
+    return (int) (codechar - code_out);
+}
+
+size_t base16_encoded_length(size_t length_in)
+{
+    return 2 * length_in;
+}
+
+/* bounds the int lengths of the block functions */
+#define BASE16_CHUNK (1 << 28)
+
+size_t base16_encode(const char* plaintext_in, size_t length_in, char* code_out, int uppercase)
+{
+    base16_encodestate state;
+    char* codechar = code_out;
+
+    base16_init_encodestate(&state);
+    base16_encodestate_set_case(&state, uppercase);
+    while (length_in > 0)
+    {
+        const int chunk = (length_in > BASE16_CHUNK) ? BASE16_CHUNK : (int) length_in;
+        codechar += base16_encode_block(plaintext_in, chunk, codechar, &state);
+        plaintext_in += chunk;
+        length_in -= chunk;
+    }
+    return codechar - code_out;
+}
+
+void base16_init_decodestate(base16_decodestate* state_in)
+{
+    state_in->step = base16_step_hi;
+    state_in->plainchar = 0;
+    state_in->mode = base64_lenient;
+    state_in->offset = 0;
+}
+
+void base16_decodestate_set_mode(base16_decodestate* state_in, base64_decodemode mode)
+{
+    state_in->mode = mode;
+}
+
+/*
+Decode whole digit pairs for as long as there is nothing but digits.
+Returns the number of bytes written, '*consumed' is set to the number of
+characters read. Every store trails the loads it depends on.
+*/
+static int base16_decode_bulk(const char* code_in, int length_in, char* plaintext_out, int* consumed)
+{
+    const char* codechar = code_in;
+    char* plainchar = plaintext_out;
+
+#if defined(SIMD_SSSE3)
+    {
+        const __m128i weights = _mm_set1_epi16(0x0110);
+#if defined(SIMD_AVX2)
+        const __m256i weights_avx2 = _mm256_set1_epi16(0x0110);
+
+        while (length_in >= 64)
+        {
+            __m256i a = _mm256_loadu_si256((const __m256i*) codechar);
+            __m256i b = _mm256_loadu_si256((const __m256i*) (codechar + 32));
+            if (!hex_translate_avx2(&a) || !hex_translate_avx2(&b))
+                break;
+            a = _mm256_maddubs_epi16(a, weights_avx2);
+            b = _mm256_maddubs_epi16(b, weights_avx2);
+            /* the pack works per 128 bit lane */
+            a = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+            _mm256_storeu_si256((__m256i*) plainchar, a);
+            codechar += 64; length_in -= 64; plainchar += 32;
+        }
+#endif
+        while (length_in >= 32)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i*) codechar);
+            __m128i b = _mm_loadu_si128((const __m128i*) (codechar + 16));
+            if (!hex_translate(&a) || !hex_translate(&b))
+                break;
+            /* high digit times 16 plus low digit, per pair */
+            a = _mm_maddubs_epi16(a, weights);
+            b = _mm_maddubs_epi16(b, weights);
+            _mm_storeu_si128((__m128i*) plainchar, _mm_packus_epi16(a, b));
+            codechar += 32; length_in -= 32; plainchar += 16;
+        }
+    }
+#endif
+    while (length_in >= 2)
+    {
+        const int hi = hex_value[(unsigned char) codechar[0]];
+        const int lo = hex_value[(unsigned char) codechar[1]];
+        if ((hi | lo) < 0)
+            break;
+        *plainchar++ = (char) ((hi << 4) | lo);
+        codechar += 2; length_in -= 2;
+    }
+    *consumed = (int) (codechar - code_in);
+    return (int) (plainchar - plaintext_out);
+}
+
+int base16_decode_block(const char* code_in, int length_in, char* plaintext_out, base16_decodestate* state_in)
+{
+    const char* codechar = code_in;
+    const char* const code_end = code_in + length_in;
+    char* plainchar = plaintext_out;
+    size_t offset;
+    int value;
+
+    if (state_in->step == base16_step_error)
+        return 0;
+    offset = state_in->offset;
+    state_in->offset += length_in;
+
+    while (codechar < code_end)
+    {
+        if (state_in->step == base16_step_hi)
+        {
+            int consumed;
+            plainchar += base16_decode_bulk(codechar, (int) (code_end - codechar), plainchar, &consumed);
+            codechar += consumed;
+            if (codechar == code_end)
+                break;
+        }
+        value = hex_value[(unsigned char) *codechar++];
+        if (value < 0)
+        {
+            if (state_in->mode == base64_lenient
+                || (state_in->mode == base64_tolerant && is_space(codechar[-1])))
+                continue;
+            state_in->step = base16_step_error;
+            state_in->offset = offset + (codechar - 1 - code_in);
+            break;
+        }
+        if (state_in->step == base16_step_hi)
+        {
+            state_in->plainchar = (char) (value << 4);
+            state_in->step = base16_step_lo;
+        }
+        else
+        {
+            *plainchar++ = (char) (state_in->plainchar | value);
+            state_in->step = base16_step_hi;
+        }
+    }
+    return (int) (plainchar - plaintext_out);
+}
+
+int base16_decode_blockend(base16_decodestate* state_in)
+{
+    if (state_in->mode == base64_lenient)
+        return 0;
+    if (state_in->step == base16_step_lo)
+        state_in->step = base16_step_error;
+    return (state_in->step == base16_step_error) ? -1 : 0;
+}
+
+size_t base16_decoded_length(const char* code_in, size_t length_in)
+{
+    size_t count = 0;
+    size_t i;
+
+    for (i = 0; i < length_in; i++)
+        count += (hex_value[(unsigned char) code_in[i]] >= 0);
+    return count / 2;
+}
+
+size_t base16_decode(const char* code_in, size_t length_in, char* plaintext_out)
+{
+    base16_decodestate state;
+    char* plainchar = plaintext_out;
+
+    base16_init_decodestate(&state);
+    while (length_in > 0)
+    {
+        const int chunk = (length_in > BASE16_CHUNK) ? BASE16_CHUNK : (int) length_in;
+        plainchar += base16_decode_block(code_in, chunk, plainchar, &state);
+        code_in += chunk;
+        length_in -= chunk;
+    }
+    return plainchar - plaintext_out;
+}
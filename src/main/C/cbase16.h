@@ -0,0 +1,77 @@
+/*
+ * cbase16.h - hex (RFC 4648 base16) encoding and decoding
+ *
+ * Follows the base64 API: block functions over a state for streams,
+ * exact sizes and one-shot functions for whole buffers, and the same
+ * lenient, tolerant and strict decode modes.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#ifndef BASE64_CBASE16_H
+#define BASE64_CBASE16_H
+
+#include <stddef.h>
+
+#include "cdecode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    int uppercase;
+} base16_encodestate;
+
+/* lower case digits */
+void base16_init_encodestate(base16_encodestate* state_in);
+
+void base16_encodestate_set_case(base16_encodestate* state_in, int uppercase);
+
+/* writes exactly 2 * length_in characters and returns that count; nothing is held back */
+int base16_encode_block(const char* plaintext_in, int length_in, char* code_out, base16_encodestate* state_in);
+
+size_t base16_encoded_length(size_t length_in);
+
+size_t base16_encode(const char* plaintext_in, size_t length_in, char* code_out, int uppercase);
+
+
+typedef enum
+{
+    base16_step_hi, base16_step_lo, base16_step_error
+} base16_decodestep;
+
+typedef struct
+{
+    base16_decodestep step;
+    char plainchar;     /* base16_step_lo: the high nibble */
+    base64_decodemode mode;
+    size_t offset;      /* characters consumed; base16_step_error: offset of the offending one */
+} base16_decodestate;
+
+/* lenient mode; digits of either case are accepted in every mode */
+void base16_init_decodestate(base16_decodestate* state_in);
+
+void base16_decodestate_set_mode(base16_decodestate* state_in, base64_decodemode mode);
+
+/*
+Decodes as base64_decode_block does, including in place. A pending high
+nibble stays in the state rather than in plaintext_out.
+*/
+int base16_decode_block(const char* code_in, int length_in, char* plaintext_out, base16_decodestate* state_in);
+
+/* as base64_decode_blockend: -1 on an error or an odd number of digits, outside lenient mode */
+int base16_decode_blockend(base16_decodestate* state_in);
+
+/* exact number of bytes base16_decode produces */
+size_t base16_decoded_length(const char* code_in, size_t length_in);
+
+/* lenient one-shot decoding, may be done in place */
+size_t base16_decode(const char* code_in, size_t length_in, char* plaintext_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASE64_CBASE16_H */
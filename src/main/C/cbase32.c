@@ -0,0 +1,461 @@
+/*
+ * cbase32.c - RFC 4648 base32 encoding and decoding
+ *
+ * 5 bytes make a group of 8 characters. The vector encoder gathers two
+ * groups into the low 40 bits of 64 bit lanes and splits them 20, 10
+ * and 5 bits at a time with shifts; the decoder range checks the
+ * characters and merges them back with multiply-adds.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#include "cbase32.h"
+#include "simd.h"
+
+typedef struct
+{
+    const char* chars;
+    const signed char* decode;
+    /* vector encoder: character = index + enc_base, plus enc_delta above enc_split */
+    char enc_base;
+    char enc_split;
+    char enc_delta;
+    /* vector decoder: three ranges of characters and the value of their first one */
+    unsigned char dec_first[3];
+    unsigned char dec_span[3];
+    unsigned char dec_value[3];
+} base32_codec;
+
+/* character values, either case, -1 for anything else */
+static const signed char decode_standard[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 26, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+static const signed char decode_extended_hex[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    25, 26, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+static const base32_codec codecs[2] =
+{
+    {
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567", decode_standard,
+        'A', 25, '2' - 26 - 'A',
+        { 'A', 'a', '2' }, { 25, 25, 5 }, { 0, 0, 26 }
+    },
+    {
+        "0123456789ABCDEFGHIJKLMNOPQRSTUV", decode_extended_hex,
+        '0', 9, 'A' - 10 - '0',
+        { '0', 'A', 'a' }, { 9, 21, 21 }, { 0, 10, 10 }
+    }
+};
+
+static int is_space(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static void encode_group(const unsigned char* b, char* out, const char* chars)
+{
+    out[0] = chars[b[0] >> 3];
+    out[1] = chars[((b[0] & 0x07) << 2) | (b[1] >> 6)];
+    out[2] = chars[(b[1] >> 1) & 0x1f];
+    out[3] = chars[((b[1] & 0x01) << 4) | (b[2] >> 4)];
+    out[4] = chars[((b[2] & 0x0f) << 1) | (b[3] >> 7)];
+    out[5] = chars[(b[3] >> 2) & 0x1f];
+    out[6] = chars[((b[3] & 0x03) << 3) | (b[4] >> 5)];
+    out[7] = chars[b[4] & 0x1f];
+}
+
+#if defined(SIMD_SSSE3)
+/* 10 bytes (of 16 loaded) to 16 characters; lut holds base, split and delta */
+static __m128i b32_encode10(const char* in, const __m128i* lut)
+{
+    const __m128i gather = _mm_setr_epi8(4, 3, 2, 1, 0, -1, -1, -1, 9, 8, 7, 6, 5, -1, -1, -1);
+    __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) in), gather);
+
+    /* 32 bit lanes: the first and the second 20 bits of each group */
+    v = _mm_or_si128(_mm_srli_epi64(v, 20), _mm_srli_epi64(_mm_slli_epi64(v, 44), 12));
+    /* 16 bit lanes: 10 bits each */
+    v = _mm_or_si128(_mm_srli_epi32(v, 10), _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0x3ff)), 16));
+    /* bytes: 5 bit indices */
+    v = _mm_or_si128(_mm_srli_epi16(v, 5), _mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1f)), 8));
+    return _mm_add_epi8(_mm_add_epi8(v, lut[0]), _mm_and_si128(_mm_cmpgt_epi8(v, lut[1]), lut[2]));
+}
+
+/* characters to their values; 0 if any of the 16 is outside the alphabet */
+static int b32_translate(__m128i* v, const __m128i* lut)
+{
+    __m128i valid = _mm_setzero_si128();
+    __m128i value = _mm_setzero_si128();
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        const __m128i d = _mm_sub_epi8(*v, lut[3 * i]);
+        const __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(d, lut[3 * i + 1]), d);
+        valid = _mm_or_si128(valid, in);
+        value = _mm_or_si128(value, _mm_and_si128(in, _mm_add_epi8(d, lut[3 * i + 2])));
+    }
+    if (_mm_movemask_epi8(valid) != 0xFFFF)
+        return 0;
+    *v = value;
+    return 1;
+}
+
+/* 16 values to 10 bytes */
+static void b32_pack(__m128i v, char* out)
+{
+    const __m128i order = _mm_setr_epi8(4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1);
+    int tail;
+
+    v = _mm_maddubs_epi16(v, _mm_set1_epi16(0x0120));
+    v = _mm_madd_epi16(v, _mm_set1_epi32(0x00010400));
+    /* the low 40 bits of each 64 bit lane: first 20 bits above second */
+    v = _mm_or_si128(_mm_slli_epi64(v, 20), _mm_srli_epi64(v, 32));
+    v = _mm_shuffle_epi8(v, order);
+    _mm_storel_epi64((__m128i*) out, v);
+    tail = _mm_extract_epi16(v, 4);
+    out[8] = (char) tail;
+    out[9] = (char) (tail >> 8);
+}
+#endif /* SIMD_SSSE3 */
+
+void base32_init_encodestate(base32_encodestate* state_in)
+{
+    state_in->length = 0;
+    state_in->variant = base32_standard;
+    state_in->padding = 1;
+}
+
+void base32_encodestate_set_variant(base32_encodestate* state_in, base32_variant variant, int padding)
+{
+    state_in->variant = variant;
+    state_in->padding = padding;
+}
+
+/* whole groups; returns the characters written, '*consumed' the bytes read */
+static int base32_encode_bulk(const unsigned char* plaintext_in, int length_in, char* code_out, int* consumed,
+                              const base32_codec* codec)
+{
+    const unsigned char* plainchar = plaintext_in;
+    char* codechar = code_out;
+
+#if defined(SIMD_SSSE3)
+    {
+        __m128i lut[3];
+
+        lut[0] = _mm_set1_epi8(codec->enc_base);
+        lut[1] = _mm_set1_epi8(codec->enc_split);
+        lut[2] = _mm_set1_epi8(codec->enc_delta);
+        while (length_in >= 16)
+        {
+            _mm_storeu_si128((__m128i*) codechar, b32_encode10((const char*) plainchar, lut));
+            plainchar += 10; length_in -= 10; codechar += 16;
+        }
+    }
+#endif
+    while (length_in >= 5)
+    {
+        encode_group(plainchar, codechar, codec->chars);
+        plainchar += 5; length_in -= 5; codechar += 8;
+    }
+    *consumed = (int) (plainchar - plaintext_in);
+    return (int) (codechar - code_out);
+}
+
+int base32_encode_block(const char* plaintext_in, int length_in, char* code_out, base32_encodestate* state_in)
+{
+    const base32_codec* const codec = &codecs[state_in->variant];
+    const unsigned char* plainchar = (const unsigned char*) plaintext_in;
+    const unsigned char* const plain_end = plainchar + length_in;
+    char* codechar = code_out;
+    int consumed;
+
+    /* finish the group left over from the last call first */
+    if (state_in->length > 0)
+    {
+        while (state_in->length < 5 && plainchar < plain_end)
+            state_in->group[state_in->length++] = *plainchar++;
+        if (state_in->length < 5)
+            return 0;
+        encode_group(state_in->group, codechar, codec->chars);
+        codechar += 8;
+        state_in->length = 0;
+    }
+    codechar += base32_encode_bulk(plainchar, (int) (plain_end - plainchar), codechar, &consumed, codec);
+    plainchar += consumed;
+    while (plainchar < plain_end)
+        state_in->group[state_in->length++] = *plainchar++;
+    return (int) (codechar - code_out);
+}
+
+int base32_encode_blockend(char* code_out, base32_encodestate* state_in)
+{
+    /* characters carrying the bits of 1, 2, 3 or 4 bytes */
+    static const int used[5] = { 0, 2, 4, 5, 7 };
+    char group[8];
+    int cnt, i;
+
+    if (state_in->length == 0)
+        return 0;
+    for (i = state_in->length; i < 5; i++)
+        state_in->group[i] = 0;
+    encode_group(state_in->group, group, codecs[state_in->variant].chars);
+    cnt = used[state_in->length];
+    for (i = 0; i < cnt; i++)
+        code_out[i] = group[i];
+    if (state_in->padding)
+    {
+        for (; cnt < 8; cnt++)
+            code_out[cnt] = '=';
+    }
+    state_in->length = 0;
+    return cnt;
+}
+
+size_t base32_encoded_length(size_t length_in, int padding)
+{
+    size_t length = length_in / 5 * 8;
+
+    if (length_in % 5)
+        length += padding ? 8 : (length_in % 5 * 8 + 4) / 5;
+    return length;
+}
+
+/* bounds the int lengths of the block functions, a multiple of 5 */
+#define ENCODE_CHUNK (5 << 26)
+#define DECODE_CHUNK (1 << 30)
+
+size_t base32_encode(const char* plaintext_in, size_t length_in, char* code_out, base32_variant variant, int padding)
+{
+    base32_encodestate state;
+    char* codechar = code_out;
+
+    base32_init_encodestate(&state);
+    base32_encodestate_set_variant(&state, variant, padding);
+    while (length_in > 0)
+    {
+        const int chunk = (length_in > ENCODE_CHUNK) ? ENCODE_CHUNK : (int) length_in;
+        codechar += base32_encode_block(plaintext_in, chunk, codechar, &state);
+        plaintext_in += chunk;
+        length_in -= chunk;
+    }
+    codechar += base32_encode_blockend(codechar, &state);
+    return codechar - code_out;
+}
+
+void base32_init_decodestate(base32_decodestate* state_in)
+{
+    state_in->step = base32_step_data;
+    state_in->bits = 0;
+    state_in->nbits = 0;
+    state_in->chars = 0;
+    state_in->padding = 0;
+    state_in->variant = base32_standard;
+    state_in->mode = base64_lenient;
+    state_in->offset = 0;
+}
+
+void base32_decodestate_set_variant(base32_decodestate* state_in, base32_variant variant)
+{
+    state_in->variant = variant;
+}
+
+void base32_decodestate_set_mode(base32_decodestate* state_in, base64_decodemode mode)
+{
+    state_in->mode = mode;
+}
+
+/*
+Whole groups for as long as there is nothing but alphabet characters.
+Returns the number of bytes written, '*consumed' is set to the number of
+characters read. Every store trails the loads it depends on.
+*/
+static int base32_decode_bulk(const char* code_in, int length_in, char* plaintext_out, int* consumed,
+                              const base32_codec* codec)
+{
+    const signed char* const decode = codec->decode;
+    const char* codechar = code_in;
+    char* plainchar = plaintext_out;
+
+#if defined(SIMD_SSSE3)
+    {
+        __m128i lut[9];
+        int i;
+
+        for (i = 0; i < 3; i++)
+        {
+            lut[3 * i] = _mm_set1_epi8((char) codec->dec_first[i]);
+            lut[3 * i + 1] = _mm_set1_epi8((char) codec->dec_span[i]);
+            lut[3 * i + 2] = _mm_set1_epi8((char) codec->dec_value[i]);
+        }
+        while (length_in >= 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*) codechar);
+            if (!b32_translate(&v, lut))
+                break;
+            b32_pack(v, plainchar);
+            codechar += 16; length_in -= 16; plainchar += 10;
+        }
+    }
+#endif
+    while (length_in >= 8)
+    {
+        const int v0 = decode[(unsigned char) codechar[0]], v1 = decode[(unsigned char) codechar[1]];
+        const int v2 = decode[(unsigned char) codechar[2]], v3 = decode[(unsigned char) codechar[3]];
+        const int v4 = decode[(unsigned char) codechar[4]], v5 = decode[(unsigned char) codechar[5]];
+        const int v6 = decode[(unsigned char) codechar[6]], v7 = decode[(unsigned char) codechar[7]];
+        unsigned int hi, lo;
+
+        if ((v0 | v1 | v2 | v3 | v4 | v5 | v6 | v7) < 0)
+            break;
+        hi = (v0 << 15) | (v1 << 10) | (v2 << 5) | v3;
+        lo = (v4 << 15) | (v5 << 10) | (v6 << 5) | v7;
+        plainchar[0] = (char) (hi >> 12);
+        plainchar[1] = (char) (hi >> 4);
+        plainchar[2] = (char) ((hi << 4) | (lo >> 16));
+        plainchar[3] = (char) (lo >> 8);
+        plainchar[4] = (char) lo;
+        codechar += 8; length_in -= 8; plainchar += 5;
+    }
+    *consumed = (int) (codechar - code_in);
+    return (int) (plainchar - plaintext_out);
+}
+
+/* group lengths padding may complete: 2, 4, 5 and 7 characters */
+#define PADDABLE 0xb4
+
+int base32_decode_block(const char* code_in, int length_in, char* plaintext_out, base32_decodestate* state_in)
+{
+    const base32_codec* const codec = &codecs[state_in->variant];
+    const char* codechar = code_in;
+    const char* const code_end = code_in + length_in;
+    char* plainchar = plaintext_out;
+    size_t offset;
+    int value;
+    char c;
+
+    if (state_in->step == base32_step_error)
+        return 0;
+    offset = state_in->offset;
+    state_in->offset += length_in;
+
+    while (codechar < code_end)
+    {
+        if (state_in->step == base32_step_pad)
+        {
+            c = *codechar++;
+            if (c == '=' && state_in->padding > 0)
+                state_in->padding--;
+            else if (state_in->mode != base64_tolerant || !is_space(c))
+            {
+                state_in->step = base32_step_error;
+                state_in->offset = offset + (codechar - 1 - code_in);
+                break;
+            }
+            continue;
+        }
+        if (state_in->chars == 0)
+        {
+            int consumed;
+            plainchar += base32_decode_bulk(codechar, (int) (code_end - codechar), plainchar, &consumed, codec);
+            codechar += consumed;
+            if (codechar == code_end)
+                break;
+        }
+        c = *codechar++;
+        value = codec->decode[(unsigned char) c];
+        if (value < 0)
+        {
+            if (state_in->mode == base64_lenient || (state_in->mode == base64_tolerant && is_space(c)))
+                continue;
+            if (c != '=' || !(PADDABLE & (1 << state_in->chars)))
+            {
+                state_in->step = base32_step_error;
+                state_in->offset = offset + (codechar - 1 - code_in);
+                break;
+            }
+            state_in->step = base32_step_pad;
+            state_in->padding = 7 - state_in->chars;
+            continue;
+        }
+        state_in->bits = (state_in->bits << 5) | value;
+        state_in->nbits += 5;
+        if (state_in->nbits >= 8)
+        {
+            state_in->nbits -= 8;
+            *plainchar++ = (char) (state_in->bits >> state_in->nbits);
+            state_in->bits &= (1u << state_in->nbits) - 1;
+        }
+        state_in->chars = (state_in->chars + 1) & 7;
+    }
+    return (int) (plainchar - plaintext_out);
+}
+
+int base32_decode_blockend(base32_decodestate* state_in)
+{
+    if (state_in->mode == base64_lenient)
+        return 0;
+    if ((state_in->step == base32_step_data && state_in->chars != 0 && !(PADDABLE & (1 << state_in->chars)))
+        || (state_in->step == base32_step_pad && state_in->padding > 0))
+        state_in->step = base32_step_error;
+    return (state_in->step == base32_step_error) ? -1 : 0;
+}
+
+size_t base32_decoded_length(const char* code_in, size_t length_in, base32_variant variant)
+{
+    const signed char* const decode = codecs[variant].decode;
+    size_t count = 0;
+    size_t i;
+
+    for (i = 0; i < length_in; i++)
+        count += (decode[(unsigned char) code_in[i]] >= 0);
+    return count / 8 * 5 + count % 8 * 5 / 8;
+}
+
+size_t base32_decode(const char* code_in, size_t length_in, char* plaintext_out, base32_variant variant)
+{
+    base32_decodestate state;
+    char* plainchar = plaintext_out;
+
+    base32_init_decodestate(&state);
+    base32_decodestate_set_variant(&state, variant);
+    while (length_in > 0)
+    {
+        const int chunk = (length_in > DECODE_CHUNK) ? DECODE_CHUNK : (int) length_in;
+        plainchar += base32_decode_block(code_in, chunk, plainchar, &state);
+        code_in += chunk;
+        length_in -= chunk;
+    }
+    return plainchar - plaintext_out;
+}
@@ -0,0 +1,99 @@
+/*
+ * cbase32.h - RFC 4648 base32 encoding and decoding
+ *
+ * Follows the base64 API: block functions over a state for streams,
+ * exact sizes and one-shot functions for whole buffers, and the same
+ * lenient, tolerant and strict decode modes.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#ifndef BASE64_CBASE32_H
+#define BASE64_CBASE32_H
+
+#include <stddef.h>
+
+#include "cdecode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    base32_standard,        /* RFC 4648 section 6, A-Z 2-7 */
+    base32_extended_hex     /* RFC 4648 section 7, 0-9 A-V */
+} base32_variant;
+
+typedef struct
+{
+    unsigned char group[5];     /* bytes of an unfinished 5 byte group */
+    int length;
+    base32_variant variant;
+    int padding;
+} base32_encodestate;
+
+/* standard alphabet with padding, no line wrapping */
+void base32_init_encodestate(base32_encodestate* state_in);
+
+void base32_encodestate_set_variant(base32_encodestate* state_in, base32_variant variant, int padding);
+
+/* an unfinished group is held in the state until more input or the blockend */
+int base32_encode_block(const char* plaintext_in, int length_in, char* code_out, base32_encodestate* state_in);
+
+/*
+Flush the unfinished group, padded to 8 characters if padding is on.
+Writes no '\0'; returns the number of characters written, at most 8.
+*/
+int base32_encode_blockend(char* code_out, base32_encodestate* state_in);
+
+size_t base32_encoded_length(size_t length_in, int padding);
+
+size_t base32_encode(const char* plaintext_in, size_t length_in, char* code_out, base32_variant variant, int padding);
+
+
+typedef enum
+{
+    base32_step_data, base32_step_pad, base32_step_error
+} base32_decodestep;
+
+typedef struct
+{
+    base32_decodestep step;
+    unsigned int bits;      /* not yet decoded, fewer than 8 */
+    int nbits;
+    int chars;              /* characters into the current 8 character group */
+    int padding;            /* base32_step_pad: '=' characters still expected */
+    base32_variant variant;
+    base64_decodemode mode;
+    size_t offset;          /* characters consumed; base32_step_error: offset of the offending one */
+} base32_decodestate;
+
+/* standard alphabet, lenient mode; letters of either case are accepted in every mode */
+void base32_init_decodestate(base32_decodestate* state_in);
+
+void base32_decodestate_set_variant(base32_decodestate* state_in, base32_variant variant);
+
+/*
+In the tolerant and strict modes padding is optional, but where present
+it must complete the group; see base64_decodestate_set_mode.
+*/
+void base32_decodestate_set_mode(base32_decodestate* state_in, base64_decodemode mode);
+
+/* decodes as base64_decode_block does, including in place; partial bytes stay in the state */
+int base32_decode_block(const char* code_in, int length_in, char* plaintext_out, base32_decodestate* state_in);
+
+/* as base64_decode_blockend */
+int base32_decode_blockend(base32_decodestate* state_in);
+
+/* exact number of bytes base32_decode produces */
+size_t base32_decoded_length(const char* code_in, size_t length_in, base32_variant variant);
+
+/* lenient one-shot decoding, may be done in place */
+size_t base32_decode(const char* code_in, size_t length_in, char* plaintext_out, base32_variant variant);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASE64_CBASE32_H */
@@ -6,82 +6,566 @@ For details, see http://sourceforge.net/projects/libb64
 */
 
 #include "cdecode.h"
+#include "simd.h"
 
-static int base64_decode_value(char value_in)
+#include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/* what the tolerant and strict modes make of characters outside the alphabet */
+#define CLASS_OTHER 0
+#define CLASS_SPACE 1
+#define CLASS_PAD 2
+
+static const unsigned char char_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+#if defined(SIMD_SSSE3)
+/*
+ * Vector kernels (Mula/Lemire/Kurz): classify every character by its
+ * two nibbles with pshufb lookups, so one mask tells whether a chunk is
+ * all alphabet; translate with a per-nibble offset (one character of
+ * the alphabet is moved to a spare one), then merge four sextets into
+ * three bytes with pmaddubsw/pmaddwd and a final byte shuffle. The
+ * constants come from the alphabet, see calphabet.c; lut[] holds the
+ * low and high nibble classes, the offsets, and the redirected
+ * character with its index adjustment.
+ */
+/* bit i set if character i is in the alphabet */
+static int dec_valid_mask(__m128i v, const __m128i* lut)
+{
+    const __m128i mask_2f = _mm_set1_epi8(0x2f);
+    __m128i lo = _mm_shuffle_epi8(lut[0], _mm_and_si128(v, mask_2f));
+    __m128i hi = _mm_shuffle_epi8(lut[1], _mm_and_si128(_mm_srli_epi32(v, 4), mask_2f));
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128()));
+}
+
+static int dec_translate(__m128i* v, const __m128i* lut)
+{
+    __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(*v, 4), _mm_set1_epi8(0x2f));
+    __m128i roll;
+
+    if (dec_valid_mask(*v, lut) != 0xFFFF)
+        return 0;
+    roll = _mm_and_si128(_mm_cmpeq_epi8(*v, lut[3]), lut[4]);
+    roll = _mm_shuffle_epi8(lut[2], _mm_add_epi8(roll, hi_nibbles));
+    *v = _mm_add_epi8(*v, roll);
+    return 1;
+}
+
+static __m128i dec_reshuffle(__m128i v)
+{
+    v = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+    v = _mm_madd_epi16(v, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(v, _mm_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+#endif /* SIMD_SSSE3 */
+
+#if defined(SIMD_AVX2)
+static int dec_translate_avx2(__m256i* v, const __m256i* lut)
+{
+    const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+    __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(*v, 4), mask_2f);
+    __m256i lo_nibbles = _mm256_and_si256(*v, mask_2f);
+    __m256i lo = _mm256_shuffle_epi8(lut[0], lo_nibbles);
+    __m256i hi = _mm256_shuffle_epi8(lut[1], hi_nibbles);
+    __m256i roll;
+
+    if (!_mm256_testz_si256(lo, hi))
+        return 0;
+    roll = _mm256_and_si256(_mm256_cmpeq_epi8(*v, lut[3]), lut[4]);
+    roll = _mm256_shuffle_epi8(lut[2], _mm256_add_epi8(roll, hi_nibbles));
+    *v = _mm256_add_epi8(*v, roll);
+    return 1;
+}
+
+static __m256i dec_reshuffle_avx2(__m256i v)
 {
-    static const char decoding[] = {62,-1,-1,-1,63,52,53,54,55,56,57,58,59,60,61,-1,-1,-1,-2,-1,-1,-1,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,-1,-1,-1,-1,-1,-1,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51};
-    static const char decoding_size = sizeof(decoding);
-    value_in -= 43;
-    if (value_in < 0 || value_in > decoding_size) return -1;
-    return decoding[(int) value_in];
+    v = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+    v = _mm256_madd_epi16(v, _mm256_set1_epi32(0x00011000));
+    v = _mm256_shuffle_epi8(v, _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    /* pack the two 12 byte lanes together */
+    return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1));
+}
+#endif /* SIMD_AVX2 */
+
+/*
+ * Decode whole chunks of 32 (AVX2) or 16 characters, then single quads,
+ * for as long as they contain nothing but alphabet characters. Stops at
+ * the first chunk with anything else in it (line breaks, padding,
+ * garbage), which the state machine then deals with. Only exactly the
+ * decoded bytes are stored.
+ *
+ * Returns the number of bytes written, '*consumed' is set to the
+ * number of characters read.
+ */
+static int base64_decode_bulk(const char* code_in, int length_in, char* plaintext_out, int* consumed,
+                             const base64_alphabet* alphabet)
+{
+    const char* codechar = code_in;
+    char* plainchar = plaintext_out;
+    const uint32_t (* const decode)[256] = alphabet->decode;
+
+#if defined(SIMD_SSSE3)
+    if (alphabet->dec_simd)
+    {
+        __m128i lut[5];
+
+        lut[0] = _mm_loadu_si128((const __m128i*) alphabet->dec_lo);
+        lut[1] = _mm_loadu_si128((const __m128i*) alphabet->dec_hi);
+        lut[2] = _mm_loadu_si128((const __m128i*) alphabet->dec_roll);
+        lut[3] = _mm_set1_epi8(alphabet->dec_special);
+        lut[4] = _mm_set1_epi8(alphabet->dec_delta);
+#if defined(SIMD_AVX2)
+        {
+            __m256i lut_avx2[5];
+            int i;
+
+            for (i = 0; i < 5; i++)
+                lut_avx2[i] = _mm256_broadcastsi128_si256(lut[i]);
+            while (length_in >= 32)
+            {
+                __m256i v = _mm256_loadu_si256((const __m256i*) codechar);
+                if (!dec_translate_avx2(&v, lut_avx2))
+                    break;
+                v = dec_reshuffle_avx2(v);
+                _mm_storeu_si128((__m128i*) plainchar, _mm256_castsi256_si128(v));
+                _mm_storel_epi64((__m128i*) (plainchar + 16), _mm256_extracti128_si256(v, 1));
+                codechar += 32; length_in -= 32; plainchar += 24;
+            }
+        }
+#endif
+        while (length_in >= 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*) codechar);
+            int tail;
+            if (!dec_translate(&v, lut))
+                break;
+            v = dec_reshuffle(v);
+            _mm_storel_epi64((__m128i*) plainchar, v);
+            tail = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+            memcpy(plainchar + 8, &tail, 4);
+            codechar += 16; length_in -= 16; plainchar += 12;
+        }
+    }
+#endif
+    while (length_in >= 4)
+    {
+        const uint32_t v = decode[0][(unsigned char) codechar[0]] | decode[1][(unsigned char) codechar[1]]
+                         | decode[2][(unsigned char) codechar[2]] | decode[3][(unsigned char) codechar[3]];
+        if (v & BASE64_BAD_CHAR)
+            break;
+        plainchar[0] = (char) (v >> 16);
+        plainchar[1] = (char) (v >> 8);
+        plainchar[2] = (char) v;
+        codechar += 4; length_in -= 4; plainchar += 3;
+    }
+    *consumed = (int) (codechar - code_in);
+    return (int) (plainchar - plaintext_out);
 }
 
 void base64_init_decodestate(base64_decodestate* state_in)
 {
     state_in->step = step_a;
     state_in->plainchar = 0;
+    state_in->alphabet = &base64_alphabet_standard;
+    state_in->mode = base64_lenient;
+    state_in->padding = 0;
+    state_in->offset = 0;
+}
+
+void base64_decodestate_set_alphabet(base64_decodestate* state_in, const base64_alphabet* alphabet)
+{
+    state_in->alphabet = alphabet;
+}
+
+void base64_decodestate_set_mode(base64_decodestate* state_in, base64_decodemode mode)
+{
+    state_in->mode = mode;
+}
+
+/* 1 if a character outside the alphabet is skipped in this mode */
+static int base64_decode_skip(const base64_decodestate* state_in, char c)
+{
+    if (state_in->mode == base64_lenient) return 1;
+    return state_in->mode == base64_tolerant && char_class[(unsigned char) c] == CLASS_SPACE;
+}
+
+/*
+Tolerant and strict modes: check what follows the first '=' of the
+padding. 'offset' is that of codechar in the stream.
+*/
+static void base64_decode_trailer(const char* codechar, const char* code_end, size_t offset, base64_decodestate* state_in)
+{
+    for (; codechar < code_end; codechar++, offset++)
+    {
+        const unsigned char cls = char_class[(unsigned char) *codechar];
+        if (cls == CLASS_PAD && state_in->padding > 0)
+        {
+            state_in->padding--;
+        }
+        else if (cls != CLASS_SPACE || state_in->mode != base64_tolerant)
+        {
+            state_in->step = step_error;
+            state_in->offset = offset;
+            return;
+        }
+    }
+}
+
+/*
+The character before codechar may not be skipped: the start of the
+padding after two or three characters of a quad, or an error.
+*/
+static void base64_decode_stop(const char* codechar, const char* code_end, size_t offset, base64_decodestate* state_in)
+{
+    if (char_class[(unsigned char) codechar[-1]] == CLASS_PAD
+        && (state_in->step == step_c || state_in->step == step_d))
+    {
+        state_in->padding = (state_in->step == step_c) ? 1 : 0;
+        state_in->step = step_pad;
+        base64_decode_trailer(codechar, code_end, offset, state_in);
+    }
+    else
+    {
+        state_in->step = step_error;
+        state_in->offset = offset - 1;
+    }
 }
 
 int base64_decode_block(const char* code_in, const int length_in, char* plaintext_out, base64_decodestate* state_in)
 {
     const char* codechar = code_in;
+    const char* const code_end = code_in + length_in;
     char* plainchar = plaintext_out;
+    const uint32_t* const decode = state_in->alphabet->decode[3];
+    uint32_t value;
+    size_t offset;
     char fragment;
 
-    *plainchar = state_in->plainchar;
+    if (state_in->step == step_error)
+        return 0;
+    offset = state_in->offset;
+    state_in->offset += length_in;
+    if (state_in->step == step_pad)
+    {
+        base64_decode_trailer(code_in, code_end, offset, state_in);
+        return 0;
+    }
+
+    /*
+    Only a quad in progress has a byte pending. Storing it at a quad
+    boundary would write ahead of the input when decoding in place.
+    */
+    if (state_in->step != step_a)
+        *plainchar = state_in->plainchar;
 
     switch (state_in->step)
     {
         while (1)
         {
     case step_a:
+            {
+                int consumed;
+                plainchar += base64_decode_bulk(codechar, (int) (code_in + length_in - codechar), plainchar, &consumed,
+                                               state_in->alphabet);
+                codechar += consumed;
+            }
             do {
-                if (codechar == code_in + length_in)
+                if (codechar == code_end)
                 {
                     state_in->step = step_a;
-                    state_in->plainchar = *plainchar;
+                    /* nothing pending at a quad boundary, and *plainchar may be past the output */
+                    state_in->plainchar = 0;
                     return plainchar - plaintext_out;
                 }
-                fragment = (char) base64_decode_value(*codechar++);
-            } while (fragment < 0);
+                value = decode[(unsigned char) *codechar++];
+            } while ((value & BASE64_BAD_CHAR) && base64_decode_skip(state_in, codechar[-1]));
+            if (value & BASE64_BAD_CHAR)
+            {
+                state_in->step = step_a;
+                base64_decode_stop(codechar, code_end, offset + (codechar - code_in), state_in);
+                return plainchar - plaintext_out;
+            }
+            fragment = (char) value;
             *plainchar    = (fragment & 0x03f) << 2;
     case step_b:
             do {
-                if (codechar == code_in + length_in)
+                if (codechar == code_end)
                 {
                     state_in->step = step_b;
                     state_in->plainchar = *plainchar;
                     return plainchar - plaintext_out;
                 }
-                fragment = (char) base64_decode_value(*codechar++);
-            } while (fragment < 0);
+                value = decode[(unsigned char) *codechar++];
+            } while ((value & BASE64_BAD_CHAR) && base64_decode_skip(state_in, codechar[-1]));
+            if (value & BASE64_BAD_CHAR)
+            {
+                state_in->step = step_b;
+                base64_decode_stop(codechar, code_end, offset + (codechar - code_in), state_in);
+                return plainchar - plaintext_out;
+            }
+            fragment = (char) value;
             *plainchar++ |= (fragment & 0x030) >> 4;
             *plainchar    = (fragment & 0x00f) << 4;
     case step_c:
             do {
-                if (codechar == code_in + length_in)
+                if (codechar == code_end)
                 {
                     state_in->step = step_c;
                     state_in->plainchar = *plainchar;
                     return plainchar - plaintext_out;
                 }
-                fragment = (char) base64_decode_value(*codechar++);
-            } while (fragment < 0);
+                value = decode[(unsigned char) *codechar++];
+            } while ((value & BASE64_BAD_CHAR) && base64_decode_skip(state_in, codechar[-1]));
+            if (value & BASE64_BAD_CHAR)
+            {
+                state_in->step = step_c;
+                base64_decode_stop(codechar, code_end, offset + (codechar - code_in), state_in);
+                return plainchar - plaintext_out;
+            }
+            fragment = (char) value;
             *plainchar++ |= (fragment & 0x03c) >> 2;
             *plainchar    = (fragment & 0x003) << 6;
     case step_d:
             do {
-                if (codechar == code_in + length_in)
+                if (codechar == code_end)
                 {
                     state_in->step = step_d;
                     state_in->plainchar = *plainchar;
                     return plainchar - plaintext_out;
                 }
-                fragment = (char) base64_decode_value(*codechar++);
-            } while (fragment < 0);
+                value = decode[(unsigned char) *codechar++];
+            } while ((value & BASE64_BAD_CHAR) && base64_decode_skip(state_in, codechar[-1]));
+            if (value & BASE64_BAD_CHAR)
+            {
+                state_in->step = step_d;
+                base64_decode_stop(codechar, code_end, offset + (codechar - code_in), state_in);
+                return plainchar - plaintext_out;
+            }
+            fragment = (char) value;
             *plainchar++ |= (fragment & 0x03f);
         }
+    case step_pad:
+    case step_error:
+        /* dealt with above */
+        break;
     }
     /* control should not reach here */
     return plainchar - plaintext_out;
 }
+
+int base64_decode_blockend(base64_decodestate* state_in)
+{
+    if (state_in->mode == base64_lenient)
+        return 0;
+    switch (state_in->step)
+    {
+    case step_b:
+        state_in->step = step_error;
+        return -1;
+    case step_pad:
+        if (state_in->padding == 0)
+            return 0;
+        state_in->step = step_error;
+        return -1;
+    case step_error:
+        return -1;
+    default:
+        return 0;
+    }
+}
+
+#if defined(SIMD_SSSE3)
+/* index of the lowest clear bit of a 16 bit mask that has one */
+static int first_clear_bit(int mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, (unsigned long) ~mask);
+    return (int) index;
+#else
+    return __builtin_ctz((unsigned int) ~mask);
+#endif
+}
+#endif /* SIMD_SSSE3 */
+
+/*
+Count the alphabet characters in the input; '*split' is set to just past
+the last character of the last complete quad. The tolerant and strict
+modes check the input on the way: returns -1 with '*error' set as by
+base64_decode_blockend if it is malformed, 0 otherwise.
+*/
+static int base64_count_values(const char* code_in, size_t length_in, const base64_alphabet* alphabet,
+                               base64_decodemode mode, size_t* count_out, size_t* split, size_t* error)
+{
+    const uint32_t* const decode = alphabet->decode[3];
+    size_t count = 0;
+    size_t i = 0;
+    int padding = -1;       /* '=' still allowed once the padding started */
+#if defined(SIMD_SSSE3)
+    __m128i lut[2];
+
+    lut[0] = _mm_loadu_si128((const __m128i*) alphabet->dec_lo);
+    lut[1] = _mm_loadu_si128((const __m128i*) alphabet->dec_hi);
+#endif
+
+    *split = 0;
+    while (i < length_in)
+    {
+        unsigned char c;
+#if defined(SIMD_SSSE3)
+        /* runs of alphabet characters 16 at a time */
+        if (alphabet->dec_simd && padding < 0 && length_in - i >= 16)
+        {
+            const int valid = dec_valid_mask(_mm_loadu_si128((const __m128i*) (code_in + i)), lut);
+            const int n = (valid == 0xFFFF) ? 16 : first_clear_bit(valid);
+            if (n > 0)
+            {
+                const int r = (int) ((3 - count) & 3);
+                if (r < n)
+                    *split = i + r + (n - 1 - r) / 4 * 4 + 1;
+                count += n;
+                i += n;
+                continue;
+            }
+        }
+#endif
+        c = (unsigned char) code_in[i];
+        if (!(decode[c] & BASE64_BAD_CHAR))
+        {
+            if (padding >= 0)
+                break;
+            if ((++count & 3) == 0)
+                *split = i + 1;
+        }
+        else if (mode != base64_lenient)
+        {
+            if (char_class[c] == CLASS_SPACE && mode == base64_tolerant)
+                ;
+            else if (char_class[c] != CLASS_PAD)
+                break;
+            else if (padding < 0 && (count & 3) >= 2)
+                padding = 3 - (int) (count & 3);
+            else if (padding > 0)
+                padding--;
+            else
+                break;
+        }
+        i++;
+    }
+    *count_out = count;
+    if (mode == base64_lenient)
+        return 0;
+    if (i == length_in && (count & 3) != 1 && padding <= 0)
+        return 0;
+    *error = i;
+    return -1;
+}
+
+size_t base64_decoded_length(const char* code_in, size_t length_in, const base64_alphabet* alphabet)
+{
+    size_t count, split;
+
+    if (alphabet == NULL)
+        alphabet = &base64_alphabet_standard;
+    base64_count_values(code_in, length_in, alphabet, base64_lenient, &count, &split, NULL);
+    return count * 3 / 4;
+}
+
+/* bounds the int lengths base64_decode_block works with */
+#define DECODE_CHUNK (1 << 30)
+
+/* decode in lenient mode, given what base64_count_values found */
+static size_t base64_decode_counted(const char* code_in, size_t length_in, char* plaintext_out,
+                                    const base64_alphabet* alphabet, size_t count, size_t split)
+{
+    base64_decodestate state;
+    char* plainchar = plaintext_out;
+    char tail[3];
+
+    base64_init_decodestate(&state);
+    base64_decodestate_set_alphabet(&state, alphabet);
+
+    /*
+    The block decoder stores the partial byte of an unfinished quad
+    ahead of its output; run it over the complete quads only, where it
+    ends on a quad boundary, and decode the rest into a scratch buffer.
+    */
+    while (split > 0)
+    {
+        int chunk = (split > DECODE_CHUNK) ? DECODE_CHUNK : (int) split;
+        plainchar += base64_decode_block(code_in, chunk, plainchar, &state);
+        code_in += chunk;
+        length_in -= chunk;
+        split -= chunk;
+    }
+    if (count & 3)
+    {
+        char* tailchar = tail;
+        while (length_in > 0)
+        {
+            int chunk = (length_in > DECODE_CHUNK) ? DECODE_CHUNK : (int) length_in;
+            tailchar += base64_decode_block(code_in, chunk, tailchar, &state);
+            code_in += chunk;
+            length_in -= chunk;
+        }
+        memcpy(plainchar, tail, tailchar - tail);
+        plainchar += tailchar - tail;
+    }
+    return plainchar - plaintext_out;
+}
+
+size_t base64_decode(const char* code_in, size_t length_in, char* plaintext_out, const base64_alphabet* alphabet)
+{
+    size_t count, split;
+
+    if (alphabet == NULL)
+        alphabet = &base64_alphabet_standard;
+    base64_count_values(code_in, length_in, alphabet, base64_lenient, &count, &split, NULL);
+    return base64_decode_counted(code_in, length_in, plaintext_out, alphabet, count, split);
+}
+
+int base64_decode_checked(const char* code_in, size_t length_in, char* plaintext_out, size_t* length_out,
+                          const base64_alphabet* alphabet, base64_decodemode mode, size_t* error_offset)
+{
+    size_t count, split, error;
+
+    if (alphabet == NULL)
+        alphabet = &base64_alphabet_standard;
+    if (base64_count_values(code_in, length_in, alphabet, mode, &count, &split, &error) != 0)
+    {
+        if (error_offset != NULL)
+            *error_offset = error;
+        return -1;
+    }
+    /* valid input decodes the same in every mode */
+    *length_out = base64_decode_counted(code_in, length_in, plaintext_out, alphabet, count, split);
+    return 0;
+}
+
+size_t base64_decode_inplace(char* buffer, size_t length, const base64_alphabet* alphabet)
+{
+    return base64_decode(buffer, length, buffer, alphabet);
+}
@@ -8,6 +8,10 @@ For details, see http://sourceforge.net/projects/libb64
 #ifndef BASE64_CDECODE_H
 #define BASE64_CDECODE_H
 
+#include <stddef.h>
+
+#include "calphabet.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -15,22 +19,98 @@ extern "C" {
 
 typedef enum
 {
-    step_a, step_b, step_c, step_d
+    step_a, step_b, step_c, step_d, step_pad, step_error
 } base64_decodestep;
 
+typedef enum
+{
+    base64_lenient,     /* skip every character outside the alphabet (default) */
+    base64_tolerant,    /* skip white space only */
+    base64_strict       /* nothing but the alphabet and the final padding */
+} base64_decodemode;
+
 
 typedef struct
 {
     base64_decodestep step;
     char plainchar;
+    const base64_alphabet* alphabet;
+    base64_decodemode mode;
+    int padding;        /* step_pad: '=' characters still expected */
+    size_t offset;      /* characters consumed; step_error: offset of the offending one */
 } base64_decodestate;
 
 
+/* standard alphabet */
 void base64_init_decodestate(base64_decodestate* state_in);
 
+/*
+Decode another alphabet. Call right after initialising the state; the
+alphabet must outlive it. Padding is optional either way, the decoder
+skips '=' like any other character outside the alphabet.
+*/
+void base64_decodestate_set_alphabet(base64_decodestate* state_in, const base64_alphabet* alphabet);
+
+/*
+In the tolerant and strict modes the decoder stops at the first
+character it may not skip and enters step_error, with state_in->offset
+set to that character's offset from the start of the stream. Padding is
+optional, but where present it must be complete and nothing but (in
+tolerant mode) white space may follow it. Call right after initialising
+the state.
+*/
+void base64_decodestate_set_mode(base64_decodestate* state_in, base64_decodemode mode);
 
+/*
+Decoding in place is allowed: every byte is stored only after the
+characters it comes from have been read, by the scalar and the vector
+code alike. So plaintext_out may equal code_in, or trail it in a stream
+decoded in place block by block (the output never catches up with the
+input).
+*/
 int base64_decode_block(const char* code_in, const int length_in, char* plaintext_out, base64_decodestate* state_in);
 
+/*
+Check that the stream ended where it may: returns 0, or -1 in step_error
+or if the stream stopped one character into a quad or inside the padding
+(state_in->offset is then the length of the stream). Always 0 in
+lenient mode.
+*/
+int base64_decode_blockend(base64_decodestate* state_in);
+
+/*
+Exact number of bytes base64_decode produces for the given text. Like
+the decoder, this skips everything outside the alphabet (line breaks,
+padding), so the input has to be scanned once.
+*/
+size_t base64_decoded_length(const char* code_in, size_t length_in, const base64_alphabet* alphabet);
+
+/*
+Decode a whole buffer in one call. Writes exactly
+base64_decoded_length(code_in, length_in, alphabet) bytes to
+plaintext_out and returns that count. A NULL alphabet selects the
+standard one, for base64_decoded_length as well.
+*/
+size_t base64_decode(const char* code_in, size_t length_in, char* plaintext_out, const base64_alphabet* alphabet);
+
+/*
+base64_decode with the buffer holding the text as output: decodes it to
+the start of the buffer and returns the number of bytes there. Needs no
+second buffer. base64_decode_checked may be given plaintext_out ==
+code_in the same way.
+*/
+size_t base64_decode_inplace(char* buffer, size_t length, const base64_alphabet* alphabet);
+
+/*
+Validate and decode a whole buffer in one call, in the given mode. The
+input is checked before anything is written: returns -1 with
+*error_offset set as by base64_decode_blockend if it is malformed,
+otherwise 0 with exactly *length_out = base64_decoded_length(...) bytes
+written to plaintext_out.
+*/
+int base64_decode_checked(const char* code_in, size_t length_in, char* plaintext_out, size_t* length_out,
+                          const base64_alphabet* alphabet, base64_decodemode mode, size_t* error_offset);
+
 
 #ifdef __cplusplus
 }
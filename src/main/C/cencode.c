@@ -6,21 +6,177 @@ For details, see http://sourceforge.net/projects/libb64
 */
 
 #include "cencode.h"
+#include "simd.h"
+
+#include <string.h>
+
+const int CHARS_PER_LINE = BASE64_WRAP_DEFAULT;
 
-const int CHARS_PER_LINE = 72;
 
 void base64_init_encodestate(base64_encodestate* state_in)
 {
     state_in->step = step_A;
     state_in->result = 0;
     state_in->stepcount = 0;
+    state_in->chars_per_line = CHARS_PER_LINE;
+    state_in->alphabet = &base64_alphabet_standard;
+    state_in->padding = 1;
+}
+
+int base64_init_encodestate_wrap(base64_encodestate* state_in, int chars_per_line)
+{
+    if (chars_per_line < 0 || chars_per_line % 4 != 0) return -1;
+    base64_init_encodestate(state_in);
+    state_in->chars_per_line = chars_per_line;
+    return 0;
+}
+
+void base64_encodestate_set_alphabet(base64_encodestate* state_in, const base64_alphabet* alphabet, int padding)
+{
+    state_in->alphabet = alphabet;
+    state_in->padding = padding;
 }
 
 char base64_encode_value(char value_in)
 {
-    static const char* encoding = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     if (value_in > 63) return '=';
-    return encoding[(int)value_in];
+    return base64_alphabet_standard.chars[(int)value_in];
+}
+
+#if defined(SIMD_SSSE3)
+/*
+ * Vector kernels (Mula/Lemire): spread each 3 byte group over a 32 bit
+ * lane, cut out the four sextets with two multiplies, and map 0..63 to
+ * ASCII. Alphabets laid out like the standard one add an offset looked
+ * up with pshufb; any other alphabet is looked up 16 characters at a
+ * time and the four results merged.
+ */
+static __m128i enc_reshuffle(__m128i in)
+{
+    __m128i t0, t1, t2, t3;
+
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+static __m128i enc_translate(__m128i idx, __m128i shift_lut)
+{
+    __m128i res;
+
+    /* 0..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12, then 0..25 -> 13 */
+    res = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+    res = _mm_or_si128(res, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), idx), _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, res), idx);
+}
+
+static __m128i enc_lookup(__m128i idx, const __m128i* lut)
+{
+    const __m128i hi = _mm_srli_epi16(_mm_and_si128(idx, _mm_set1_epi8(0x30)), 4);
+    __m128i res = _mm_and_si128(_mm_shuffle_epi8(lut[0], idx), _mm_cmpeq_epi8(hi, _mm_setzero_si128()));
+    res = _mm_or_si128(res, _mm_and_si128(_mm_shuffle_epi8(lut[1], idx), _mm_cmpeq_epi8(hi, _mm_set1_epi8(1))));
+    res = _mm_or_si128(res, _mm_and_si128(_mm_shuffle_epi8(lut[2], idx), _mm_cmpeq_epi8(hi, _mm_set1_epi8(2))));
+    return _mm_or_si128(res, _mm_and_si128(_mm_shuffle_epi8(lut[3], idx), _mm_cmpeq_epi8(hi, _mm_set1_epi8(3))));
+}
+#endif /* SIMD_SSSE3 */
+
+#if defined(SIMD_AVX2)
+static __m256i enc_reshuffle_avx2(__m256i in)
+{
+    __m256i t0, t1, t2, t3;
+
+    in = _mm256_shuffle_epi8(in, _mm256_set_epi8(
+        10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+        10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    return _mm256_or_si256(t1, t3);
+}
+
+static __m256i enc_translate_avx2(__m256i idx, __m256i shift_lut)
+{
+    __m256i res;
+
+    res = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+    res = _mm256_or_si256(res, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), idx), _mm256_set1_epi8(13)));
+    return _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, res), idx);
+}
+
+static __m256i enc_lookup_avx2(__m256i idx, const __m256i* lut)
+{
+    const __m256i hi = _mm256_srli_epi16(_mm256_and_si256(idx, _mm256_set1_epi8(0x30)), 4);
+    __m256i res = _mm256_and_si256(_mm256_shuffle_epi8(lut[0], idx), _mm256_cmpeq_epi8(hi, _mm256_setzero_si256()));
+    res = _mm256_or_si256(res, _mm256_and_si256(_mm256_shuffle_epi8(lut[1], idx), _mm256_cmpeq_epi8(hi, _mm256_set1_epi8(1))));
+    res = _mm256_or_si256(res, _mm256_and_si256(_mm256_shuffle_epi8(lut[2], idx), _mm256_cmpeq_epi8(hi, _mm256_set1_epi8(2))));
+    return _mm256_or_si256(res, _mm256_and_si256(_mm256_shuffle_epi8(lut[3], idx), _mm256_cmpeq_epi8(hi, _mm256_set1_epi8(3))));
+}
+#endif /* SIMD_AVX2 */
+
+/*
+ * Encode 'groups' whole 3 byte groups to 4 characters each. 'avail' is
+ * the number of readable bytes at 'in'; the vector loads read up to 4
+ * bytes past the groups they encode, so they only run while the input
+ * buffer still covers that.
+ */
+static char* base64_encode_groups(const unsigned char* in, int groups, int avail, char* out, const base64_alphabet* alphabet)
+{
+    const char* const pairs = alphabet->pairs;
+#if defined(SIMD_SSSE3)
+    const int layout = alphabet->enc_layout;
+    const __m128i shift_lut = _mm_loadu_si128((const __m128i*) alphabet->enc_shift);
+    __m128i lut[4];
+    int i;
+
+    for (i = 0; i < 4; i++)
+        lut[i] = _mm_loadu_si128((const __m128i*) (alphabet->chars + 16 * i));
+#endif
+#if defined(SIMD_AVX2)
+    {
+        const __m256i shift_lut_avx2 = _mm256_broadcastsi128_si256(shift_lut);
+        __m256i lut_avx2[4];
+
+        for (i = 0; i < 4; i++)
+            lut_avx2[i] = _mm256_broadcastsi128_si256(lut[i]);
+        while (groups >= 8 && avail >= 28)
+        {
+            __m256i v = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*) in)),
+                _mm_loadu_si128((const __m128i*) (in + 12)), 1);
+            v = enc_reshuffle_avx2(v);
+            v = layout ? enc_translate_avx2(v, shift_lut_avx2) : enc_lookup_avx2(v, lut_avx2);
+            _mm256_storeu_si256((__m256i*) out, v);
+            in += 24; avail -= 24; groups -= 8; out += 32;
+        }
+    }
+#endif
+#if defined(SIMD_SSSE3)
+    while (groups >= 4 && avail >= 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*) in);
+        v = enc_reshuffle(v);
+        v = layout ? enc_translate(v, shift_lut) : enc_lookup(v, lut);
+        _mm_storeu_si128((__m128i*) out, v);
+        in += 12; avail -= 12; groups -= 4; out += 16;
+    }
+#endif
+    (void) avail;
+    while (groups-- > 0)
+    {
+        const unsigned int v = ((unsigned int) in[0] << 16) | ((unsigned int) in[1] << 8) | in[2];
+        const char* hi = pairs + 2 * (v >> 12);
+        const char* lo = pairs + 2 * (v & 0xfff);
+        out[0] = hi[0];
+        out[1] = hi[1];
+        out[2] = lo[0];
+        out[3] = lo[1];
+        in += 3; out += 4;
+    }
+    return out;
 }
 
 int base64_encode_block(const char* plaintext_in, int length_in, char* code_out, base64_encodestate* state_in)
@@ -28,6 +184,9 @@ int base64_encode_block(const char* plaintext_in, int length_in, char* code_out,
     const char* plainchar = plaintext_in;
     const char* const plaintextend = plaintext_in + length_in;
     char* codechar = code_out;
+    const int quads_per_line = state_in->chars_per_line / 4;
+    const base64_alphabet* const alphabet = state_in->alphabet;
+    const char* const chars = alphabet->chars;
     char result;
     char fragment;
     
@@ -38,6 +197,33 @@ int base64_encode_block(const char* plaintext_in, int length_in, char* code_out,
         while (1)
         {
     case step_A:
+            if (plaintextend - plainchar >= 3 && quads_per_line == 0)
+            {
+                /* no wrapping: all whole groups in one run */
+                int groups = (int) (plaintextend - plainchar) / 3;
+                codechar = base64_encode_groups((const unsigned char*) plainchar, groups,
+                    (int) (plaintextend - plainchar), codechar, alphabet);
+                plainchar += 3 * groups;
+            }
+            else if (plaintextend - plainchar >= 3)
+            {
+                /* finish the current line, then whole lines, then the partial last line */
+                int groups = quads_per_line - state_in->stepcount;
+                while (plaintextend - plainchar >= 3 * groups)
+                {
+                    codechar = base64_encode_groups((const unsigned char*) plainchar, groups,
+                        (int) (plaintextend - plainchar), codechar, alphabet);
+                    plainchar += 3 * groups;
+                    *codechar++ = '\n';
+                    groups = quads_per_line;
+                    state_in->stepcount = 0;
+                }
+                groups = (int) (plaintextend - plainchar) / 3;
+                codechar = base64_encode_groups((const unsigned char*) plainchar, groups,
+                    (int) (plaintextend - plainchar), codechar, alphabet);
+                plainchar += 3 * groups;
+                state_in->stepcount += groups;
+            }
             if (plainchar == plaintextend)
             {
                 state_in->result = result;
@@ -46,7 +232,7 @@ int base64_encode_block(const char* plaintext_in, int length_in, char* code_out,
             }
             fragment = *plainchar++;
             result = (fragment & 0x0fc) >> 2;
-            *codechar++ = base64_encode_value(result);
+            *codechar++ = chars[(int) result];
             result = (fragment & 0x003) << 4;
     case step_B:
             if (plainchar == plaintextend)
@@ -57,7 +243,7 @@ int base64_encode_block(const char* plaintext_in, int length_in, char* code_out,
             }
             fragment = *plainchar++;
             result |= (fragment & 0x0f0) >> 4;
-            *codechar++ = base64_encode_value(result);
+            *codechar++ = chars[(int) result];
             result = (fragment & 0x00f) << 2;
     case step_C:
             if (plainchar == plaintextend)
@@ -68,12 +254,11 @@ int base64_encode_block(const char* plaintext_in, int length_in, char* code_out,
             }
             fragment = *plainchar++;
             result |= (fragment & 0x0c0) >> 6;
-            *codechar++ = base64_encode_value(result);
+            *codechar++ = chars[(int) result];
             result  = (fragment & 0x03f) >> 0;
-            *codechar++ = base64_encode_value(result);
+            *codechar++ = chars[(int) result];
             
-            ++(state_in->stepcount);
-            if (state_in->stepcount == CHARS_PER_LINE/4) // TODO SPZ
+            if (quads_per_line != 0 && ++(state_in->stepcount) == quads_per_line)
             {
                 *codechar++ = '\n';
                 state_in->stepcount = 0;
@@ -87,17 +272,22 @@ int base64_encode_block(const char* plaintext_in, int length_in, char* code_out,
 int base64_encode_blockend(char* code_out, base64_encodestate* state_in)
 {
     char* codechar = code_out;
+    const char* const chars = state_in->alphabet->chars;
     
     switch (state_in->step)
     {
     case step_B:
-        *codechar++ = base64_encode_value(state_in->result);
-        *codechar++ = '=';
-        *codechar++ = '=';
+        *codechar++ = chars[(int) state_in->result];
+        if (state_in->padding)
+        {
+            *codechar++ = '=';
+            *codechar++ = '=';
+        }
         break;
     case step_C:
-        *codechar++ = base64_encode_value(state_in->result);
-        *codechar++ = '=';
+        *codechar++ = chars[(int) state_in->result];
+        if (state_in->padding)
+            *codechar++ = '=';
         break;
     case step_A:
         break;
@@ -108,3 +298,46 @@ int base64_encode_blockend(char* code_out, base64_encodestate* state_in)
     return codechar - code_out;
 }
 
+
+size_t base64_encoded_length(size_t length_in, int chars_per_line, int padding)
+{
+    size_t length = length_in / 3 * 4;
+
+    if (length_in % 3)
+        length += padding ? 4 : length_in % 3 + 1;
+    if (chars_per_line < 0 || chars_per_line % 4 != 0) return 0;
+    /* a newline follows every full line of whole groups */
+    if (chars_per_line > 0)
+        length += (length_in / 3) / (size_t) (chars_per_line / 4);
+    return length;
+}
+
+/* multiple of 3, and its encoding still fits the int returned by base64_encode_block */
+#define ENCODE_CHUNK (3 << 28)
+
+size_t base64_encode(const char* plaintext_in, size_t length_in, char* code_out, int chars_per_line,
+                     const base64_alphabet* alphabet, int padding)
+{
+    base64_encodestate state;
+    char* codechar = code_out;
+    char tail[5];
+    int cnt;
+
+    if (base64_init_encodestate_wrap(&state, chars_per_line) != 0) return 0;
+    if (alphabet != NULL)
+        base64_encodestate_set_alphabet(&state, alphabet, padding);
+    else
+        state.padding = padding;
+    while (length_in > 0)
+    {
+        int chunk = (length_in > ENCODE_CHUNK) ? ENCODE_CHUNK : (int) length_in;
+        codechar += base64_encode_block(plaintext_in, chunk, codechar, &state);
+        plaintext_in += chunk;
+        length_in -= chunk;
+    }
+    /* the last quad goes through a scratch buffer to drop the '\0' */
+    cnt = base64_encode_blockend(tail, &state) - 1;
+    memcpy(codechar, tail, cnt);
+    codechar += cnt;
+    return codechar - code_out;
+}
@@ -8,6 +8,10 @@ For details, see http://sourceforge.net/projects/libb64
 #ifndef BASE64_CENCODE_H
 #define BASE64_CENCODE_H
 
+#include <stddef.h>
+
+#include "calphabet.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -18,21 +22,61 @@ typedef enum
     step_A, step_B, step_C
 } base64_encodestep;
 
+/* line wrapping policies, in characters per line */
+#define BASE64_WRAP_NONE 0
+#define BASE64_WRAP_PEM 64
+#define BASE64_WRAP_MIME 76
+#define BASE64_WRAP_DEFAULT 72
+
 typedef struct
 {
     base64_encodestep step;
     char result;
     int stepcount;
+    int chars_per_line;
+    const base64_alphabet* alphabet;
+    int padding;
 } base64_encodestate;
 
+/* standard alphabet with padding, wraps lines at BASE64_WRAP_DEFAULT characters */
 void base64_init_encodestate(base64_encodestate* state_in);
 
+/*
+Wrap lines at chars_per_line characters, which must be a positive
+multiple of 4, or not at all for BASE64_WRAP_NONE. Returns -1 (and
+leaves the state alone) for any other value, 0 otherwise.
+*/
+int base64_init_encodestate_wrap(base64_encodestate* state_in, int chars_per_line);
+
+/*
+Encode with another alphabet, and with or without '=' padding of the
+last quad. Call right after initialising the state; the alphabet must
+outlive it.
+*/
+void base64_encodestate_set_alphabet(base64_encodestate* state_in, const base64_alphabet* alphabet, int padding);
+
 char base64_encode_value(char value_in);
 
 int base64_encode_block(const char* plaintext_in, int length_in, char* code_out, base64_encodestate* state_in);
 
 int base64_encode_blockend(char* code_out, base64_encodestate* state_in);
 
+/*
+Exact number of characters base64_encode produces for length_in bytes
+with lines wrapped at chars_per_line (see base64_init_encodestate_wrap),
+with or without padding. Returns 0 for an invalid chars_per_line.
+*/
+size_t base64_encoded_length(size_t length_in, int chars_per_line, int padding);
+
+/*
+Encode a whole buffer in one call. Writes exactly
+base64_encoded_length(length_in, chars_per_line, padding) characters to
+code_out, without a terminating '\0', and returns that count. A NULL
+alphabet selects the standard one.
+*/
+size_t base64_encode(const char* plaintext_in, size_t length_in, char* code_out, int chars_per_line,
+                     const base64_alphabet* alphabet, int padding);
+
 #ifdef __cplusplus
 }
 #endif
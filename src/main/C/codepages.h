@@ -0,0 +1,791 @@
+/*
+ * codepages.h - tables of the single byte codepages, included by encoding.c only
+ *
+ * Generated by gencodepages.py, do not edit.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+
+/* ISO-8859-2, Latin-2, Central European */
+static unsigned short const xmlunicodetable_ISO8859_2 [128] = {
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+    0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+    0x00a0, 0x0104, 0x02d8, 0x0141, 0x00a4, 0x013d, 0x015a, 0x00a7,
+    0x00a8, 0x0160, 0x015e, 0x0164, 0x0179, 0x00ad, 0x017d, 0x017b,
+    0x00b0, 0x0105, 0x02db, 0x0142, 0x00b4, 0x013e, 0x015b, 0x02c7,
+    0x00b8, 0x0161, 0x015f, 0x0165, 0x017a, 0x02dd, 0x017e, 0x017c,
+    0x0154, 0x00c1, 0x00c2, 0x0102, 0x00c4, 0x0139, 0x0106, 0x00c7,
+    0x010c, 0x00c9, 0x0118, 0x00cb, 0x011a, 0x00cd, 0x00ce, 0x010e,
+    0x0110, 0x0143, 0x0147, 0x00d3, 0x00d4, 0x0150, 0x00d6, 0x00d7,
+    0x0158, 0x016e, 0x00da, 0x0170, 0x00dc, 0x00dd, 0x0162, 0x00df,
+    0x0155, 0x00e1, 0x00e2, 0x0103, 0x00e4, 0x013a, 0x0107, 0x00e7,
+    0x010d, 0x00e9, 0x0119, 0x00eb, 0x011b, 0x00ed, 0x00ee, 0x010f,
+    0x0111, 0x0144, 0x0148, 0x00f3, 0x00f4, 0x0151, 0x00f6, 0x00f7,
+    0x0159, 0x016f, 0x00fa, 0x0171, 0x00fc, 0x00fd, 0x0163, 0x02d9,
+};
+
+static unsigned char const xmlutf8table_ISO8859_2 [128 * 4] = {
+    "\xc2\x80\x00\x02\xc2\x81\x00\x02\xc2\x82\x00\x02\xc2\x83\x00\x02"
+    "\xc2\x84\x00\x02\xc2\x85\x00\x02\xc2\x86\x00\x02\xc2\x87\x00\x02"
+    "\xc2\x88\x00\x02\xc2\x89\x00\x02\xc2\x8a\x00\x02\xc2\x8b\x00\x02"
+    "\xc2\x8c\x00\x02\xc2\x8d\x00\x02\xc2\x8e\x00\x02\xc2\x8f\x00\x02"
+    "\xc2\x90\x00\x02\xc2\x91\x00\x02\xc2\x92\x00\x02\xc2\x93\x00\x02"
+    "\xc2\x94\x00\x02\xc2\x95\x00\x02\xc2\x96\x00\x02\xc2\x97\x00\x02"
+    "\xc2\x98\x00\x02\xc2\x99\x00\x02\xc2\x9a\x00\x02\xc2\x9b\x00\x02"
+    "\xc2\x9c\x00\x02\xc2\x9d\x00\x02\xc2\x9e\x00\x02\xc2\x9f\x00\x02"
+    "\xc2\xa0\x00\x02\xc4\x84\x00\x02\xcb\x98\x00\x02\xc5\x81\x00\x02"
+    "\xc2\xa4\x00\x02\xc4\xbd\x00\x02\xc5\x9a\x00\x02\xc2\xa7\x00\x02"
+    "\xc2\xa8\x00\x02\xc5\xa0\x00\x02\xc5\x9e\x00\x02\xc5\xa4\x00\x02"
+    "\xc5\xb9\x00\x02\xc2\xad\x00\x02\xc5\xbd\x00\x02\xc5\xbb\x00\x02"
+    "\xc2\xb0\x00\x02\xc4\x85\x00\x02\xcb\x9b\x00\x02\xc5\x82\x00\x02"
+    "\xc2\xb4\x00\x02\xc4\xbe\x00\x02\xc5\x9b\x00\x02\xcb\x87\x00\x02"
+    "\xc2\xb8\x00\x02\xc5\xa1\x00\x02\xc5\x9f\x00\x02\xc5\xa5\x00\x02"
+    "\xc5\xba\x00\x02\xcb\x9d\x00\x02\xc5\xbe\x00\x02\xc5\xbc\x00\x02"
+    "\xc5\x94\x00\x02\xc3\x81\x00\x02\xc3\x82\x00\x02\xc4\x82\x00\x02"
+    "\xc3\x84\x00\x02\xc4\xb9\x00\x02\xc4\x86\x00\x02\xc3\x87\x00\x02"
+    "\xc4\x8c\x00\x02\xc3\x89\x00\x02\xc4\x98\x00\x02\xc3\x8b\x00\x02"
+    "\xc4\x9a\x00\x02\xc3\x8d\x00\x02\xc3\x8e\x00\x02\xc4\x8e\x00\x02"
+    "\xc4\x90\x00\x02\xc5\x83\x00\x02\xc5\x87\x00\x02\xc3\x93\x00\x02"
+    "\xc3\x94\x00\x02\xc5\x90\x00\x02\xc3\x96\x00\x02\xc3\x97\x00\x02"
+    "\xc5\x98\x00\x02\xc5\xae\x00\x02\xc3\x9a\x00\x02\xc5\xb0\x00\x02"
+    "\xc3\x9c\x00\x02\xc3\x9d\x00\x02\xc5\xa2\x00\x02\xc3\x9f\x00\x02"
+    "\xc5\x95\x00\x02\xc3\xa1\x00\x02\xc3\xa2\x00\x02\xc4\x83\x00\x02"
+    "\xc3\xa4\x00\x02\xc4\xba\x00\x02\xc4\x87\x00\x02\xc3\xa7\x00\x02"
+    "\xc4\x8d\x00\x02\xc3\xa9\x00\x02\xc4\x99\x00\x02\xc3\xab\x00\x02"
+    "\xc4\x9b\x00\x02\xc3\xad\x00\x02\xc3\xae\x00\x02\xc4\x8f\x00\x02"
+    "\xc4\x91\x00\x02\xc5\x84\x00\x02\xc5\x88\x00\x02\xc3\xb3\x00\x02"
+    "\xc3\xb4\x00\x02\xc5\x91\x00\x02\xc3\xb6\x00\x02\xc3\xb7\x00\x02"
+    "\xc5\x99\x00\x02\xc5\xaf\x00\x02\xc3\xba\x00\x02\xc5\xb1\x00\x02"
+    "\xc3\xbc\x00\x02\xc3\xbd\x00\x02\xc5\xa3\x00\x02\xcb\x99\x00\x02"
+};
+
+static unsigned char const xmltranscodetable_ISO8859_2 [48 + 6 * 64] = {
+    "\x00\x00\x01\x02\x03\x04\x00\x00\x00\x00\x00\x05\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x80\x81\x82\x83\x84\x85\x86\x87\x88\x89\x8a\x8b\x8c\x8d\x8e\x8f"
+    "\x90\x91\x92\x93\x94\x95\x96\x97\x98\x99\x9a\x9b\x9c\x9d\x9e\x9f"
+    "\xa0\x00\x00\x00\xa4\x00\x00\xa7\xa8\x00\x00\x00\x00\xad\x00\x00"
+    "\xb0\x00\x00\x00\xb4\x00\x00\x00\xb8\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\xc1\xc2\x00\xc4\x00\x00\xc7\x00\xc9\x00\xcb\x00\xcd\xce\x00"
+    "\x00\x00\x00\xd3\xd4\x00\xd6\xd7\x00\x00\xda\x00\xdc\xdd\x00\xdf"
+    "\x00\xe1\xe2\x00\xe4\x00\x00\xe7\x00\xe9\x00\xeb\x00\xed\xee\x00"
+    "\x00\x00\x00\xf3\xf4\x00\xf6\xf7\x00\x00\xfa\x00\xfc\xfd\x00\x00"
+    "\x00\x00\xc3\xe3\xa1\xb1\xc6\xe6\x00\x00\x00\x00\xc8\xe8\xcf\xef"
+    "\xd0\xf0\x00\x00\x00\x00\x00\x00\xca\xea\xcc\xec\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\xc5\xe5\x00\x00\xa5\xb5\x00"
+    "\x00\xa3\xb3\xd1\xf1\x00\x00\xd2\xf2\x00\x00\x00\x00\x00\x00\x00"
+    "\xd5\xf5\x00\x00\xc0\xe0\x00\x00\xd8\xf8\xa6\xb6\x00\x00\xaa\xba"
+    "\xa9\xb9\xde\xfe\xab\xbb\x00\x00\x00\x00\x00\x00\x00\x00\xd9\xf9"
+    "\xdb\xfb\x00\x00\x00\x00\x00\x00\x00\xac\xbc\xaf\xbf\xae\xbe\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\xb7\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\xa2\xff\x00\xb2\x00\xbd\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+const encodingCodepage encodingISO8859_2 = {
+    "ISO-8859-2", xmlunicodetable_ISO8859_2, xmlutf8table_ISO8859_2, xmltranscodetable_ISO8859_2, 0x00
+};
+
+
+/* ISO-8859-5, Cyrillic */
+static unsigned short const xmlunicodetable_ISO8859_5 [128] = {
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+    0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+    0x00a0, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405, 0x0406, 0x0407,
+    0x0408, 0x0409, 0x040a, 0x040b, 0x040c, 0x00ad, 0x040e, 0x040f,
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+    0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e, 0x041f,
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+    0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d, 0x042e, 0x042f,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+    0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f,
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+    0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e, 0x044f,
+    0x2116, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457,
+    0x0458, 0x0459, 0x045a, 0x045b, 0x045c, 0x00a7, 0x045e, 0x045f,
+};
+
+static unsigned char const xmlutf8table_ISO8859_5 [128 * 4] = {
+    "\xc2\x80\x00\x02\xc2\x81\x00\x02\xc2\x82\x00\x02\xc2\x83\x00\x02"
+    "\xc2\x84\x00\x02\xc2\x85\x00\x02\xc2\x86\x00\x02\xc2\x87\x00\x02"
+    "\xc2\x88\x00\x02\xc2\x89\x00\x02\xc2\x8a\x00\x02\xc2\x8b\x00\x02"
+    "\xc2\x8c\x00\x02\xc2\x8d\x00\x02\xc2\x8e\x00\x02\xc2\x8f\x00\x02"
+    "\xc2\x90\x00\x02\xc2\x91\x00\x02\xc2\x92\x00\x02\xc2\x93\x00\x02"
+    "\xc2\x94\x00\x02\xc2\x95\x00\x02\xc2\x96\x00\x02\xc2\x97\x00\x02"
+    "\xc2\x98\x00\x02\xc2\x99\x00\x02\xc2\x9a\x00\x02\xc2\x9b\x00\x02"
+    "\xc2\x9c\x00\x02\xc2\x9d\x00\x02\xc2\x9e\x00\x02\xc2\x9f\x00\x02"
+    "\xc2\xa0\x00\x02\xd0\x81\x00\x02\xd0\x82\x00\x02\xd0\x83\x00\x02"
+    "\xd0\x84\x00\x02\xd0\x85\x00\x02\xd0\x86\x00\x02\xd0\x87\x00\x02"
+    "\xd0\x88\x00\x02\xd0\x89\x00\x02\xd0\x8a\x00\x02\xd0\x8b\x00\x02"
+    "\xd0\x8c\x00\x02\xc2\xad\x00\x02\xd0\x8e\x00\x02\xd0\x8f\x00\x02"
+    "\xd0\x90\x00\x02\xd0\x91\x00\x02\xd0\x92\x00\x02\xd0\x93\x00\x02"
+    "\xd0\x94\x00\x02\xd0\x95\x00\x02\xd0\x96\x00\x02\xd0\x97\x00\x02"
+    "\xd0\x98\x00\x02\xd0\x99\x00\x02\xd0\x9a\x00\x02\xd0\x9b\x00\x02"
+    "\xd0\x9c\x00\x02\xd0\x9d\x00\x02\xd0\x9e\x00\x02\xd0\x9f\x00\x02"
+    "\xd0\xa0\x00\x02\xd0\xa1\x00\x02\xd0\xa2\x00\x02\xd0\xa3\x00\x02"
+    "\xd0\xa4\x00\x02\xd0\xa5\x00\x02\xd0\xa6\x00\x02\xd0\xa7\x00\x02"
+    "\xd0\xa8\x00\x02\xd0\xa9\x00\x02\xd0\xaa\x00\x02\xd0\xab\x00\x02"
+    "\xd0\xac\x00\x02\xd0\xad\x00\x02\xd0\xae\x00\x02\xd0\xaf\x00\x02"
+    "\xd0\xb0\x00\x02\xd0\xb1\x00\x02\xd0\xb2\x00\x02\xd0\xb3\x00\x02"
+    "\xd0\xb4\x00\x02\xd0\xb5\x00\x02\xd0\xb6\x00\x02\xd0\xb7\x00\x02"
+    "\xd0\xb8\x00\x02\xd0\xb9\x00\x02\xd0\xba\x00\x02\xd0\xbb\x00\x02"
+    "\xd0\xbc\x00\x02\xd0\xbd\x00\x02\xd0\xbe\x00\x02\xd0\xbf\x00\x02"
+    "\xd1\x80\x00\x02\xd1\x81\x00\x02\xd1\x82\x00\x02\xd1\x83\x00\x02"
+    "\xd1\x84\x00\x02\xd1\x85\x00\x02\xd1\x86\x00\x02\xd1\x87\x00\x02"
+    "\xd1\x88\x00\x02\xd1\x89\x00\x02\xd1\x8a\x00\x02\xd1\x8b\x00\x02"
+    "\xd1\x8c\x00\x02\xd1\x8d\x00\x02\xd1\x8e\x00\x02\xd1\x8f\x00\x02"
+    "\xe2\x84\x96\x03\xd1\x91\x00\x02\xd1\x92\x00\x02\xd1\x93\x00\x02"
+    "\xd1\x94\x00\x02\xd1\x95\x00\x02\xd1\x96\x00\x02\xd1\x97\x00\x02"
+    "\xd1\x98\x00\x02\xd1\x99\x00\x02\xd1\x9a\x00\x02\xd1\x9b\x00\x02"
+    "\xd1\x9c\x00\x02\xc2\xa7\x00\x02\xd1\x9e\x00\x02\xd1\x9f\x00\x02"
+};
+
+static unsigned char const xmltranscodetable_ISO8859_5 [48 + 6 * 64] = {
+    "\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x02\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x80\x81\x82\x83\x84\x85\x86\x87\x88\x89\x8a\x8b\x8c\x8d\x8e\x8f"
+    "\x90\x91\x92\x93\x94\x95\x96\x97\x98\x99\x9a\x9b\x9c\x9d\x9e\x9f"
+    "\xa0\x00\x00\x00\x00\x00\x00\xfd\x00\x00\x00\x00\x00\xad\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\xa1\xa2\xa3\xa4\xa5\xa6\xa7\xa8\xa9\xaa\xab\xac\x00\xae\xaf"
+    "\xb0\xb1\xb2\xb3\xb4\xb5\xb6\xb7\xb8\xb9\xba\xbb\xbc\xbd\xbe\xbf"
+    "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8\xc9\xca\xcb\xcc\xcd\xce\xcf"
+    "\xd0\xd1\xd2\xd3\xd4\xd5\xd6\xd7\xd8\xd9\xda\xdb\xdc\xdd\xde\xdf"
+    "\xe0\xe1\xe2\xe3\xe4\xe5\xe6\xe7\xe8\xe9\xea\xeb\xec\xed\xee\xef"
+    "\x00\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\x00\xfe\xff"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x05\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\xf0\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+const encodingCodepage encodingISO8859_5 = {
+    "ISO-8859-5", xmlunicodetable_ISO8859_5, xmlutf8table_ISO8859_5, xmltranscodetable_ISO8859_5, 0x00
+};
+
+
+/* ISO-8859-7, Greek */
+static unsigned short const xmlunicodetable_ISO8859_7 [128] = {
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+    0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+    0x00a0, 0x2018, 0x2019, 0x00a3, 0x20ac, 0x20af, 0x00a6, 0x00a7,
+    0x00a8, 0x00a9, 0x037a, 0x00ab, 0x00ac, 0x00ad, 0x0000, 0x2015,
+    0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x0384, 0x0385, 0x0386, 0x00b7,
+    0x0388, 0x0389, 0x038a, 0x00bb, 0x038c, 0x00bd, 0x038e, 0x038f,
+    0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+    0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f,
+    0x03a0, 0x03a1, 0x0000, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7,
+    0x03a8, 0x03a9, 0x03aa, 0x03ab, 0x03ac, 0x03ad, 0x03ae, 0x03af,
+    0x03b0, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7,
+    0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf,
+    0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+    0x03c8, 0x03c9, 0x03ca, 0x03cb, 0x03cc, 0x03cd, 0x03ce, 0x0000,
+};
+
+static unsigned char const xmlutf8table_ISO8859_7 [128 * 4] = {
+    "\xc2\x80\x00\x02\xc2\x81\x00\x02\xc2\x82\x00\x02\xc2\x83\x00\x02"
+    "\xc2\x84\x00\x02\xc2\x85\x00\x02\xc2\x86\x00\x02\xc2\x87\x00\x02"
+    "\xc2\x88\x00\x02\xc2\x89\x00\x02\xc2\x8a\x00\x02\xc2\x8b\x00\x02"
+    "\xc2\x8c\x00\x02\xc2\x8d\x00\x02\xc2\x8e\x00\x02\xc2\x8f\x00\x02"
+    "\xc2\x90\x00\x02\xc2\x91\x00\x02\xc2\x92\x00\x02\xc2\x93\x00\x02"
+    "\xc2\x94\x00\x02\xc2\x95\x00\x02\xc2\x96\x00\x02\xc2\x97\x00\x02"
+    "\xc2\x98\x00\x02\xc2\x99\x00\x02\xc2\x9a\x00\x02\xc2\x9b\x00\x02"
+    "\xc2\x9c\x00\x02\xc2\x9d\x00\x02\xc2\x9e\x00\x02\xc2\x9f\x00\x02"
+    "\xc2\xa0\x00\x02\xe2\x80\x98\x03\xe2\x80\x99\x03\xc2\xa3\x00\x02"
+    "\xe2\x82\xac\x03\xe2\x82\xaf\x03\xc2\xa6\x00\x02\xc2\xa7\x00\x02"
+    "\xc2\xa8\x00\x02\xc2\xa9\x00\x02\xcd\xba\x00\x02\xc2\xab\x00\x02"
+    "\xc2\xac\x00\x02\xc2\xad\x00\x02\x00\x00\x00\x00\xe2\x80\x95\x03"
+    "\xc2\xb0\x00\x02\xc2\xb1\x00\x02\xc2\xb2\x00\x02\xc2\xb3\x00\x02"
+    "\xce\x84\x00\x02\xce\x85\x00\x02\xce\x86\x00\x02\xc2\xb7\x00\x02"
+    "\xce\x88\x00\x02\xce\x89\x00\x02\xce\x8a\x00\x02\xc2\xbb\x00\x02"
+    "\xce\x8c\x00\x02\xc2\xbd\x00\x02\xce\x8e\x00\x02\xce\x8f\x00\x02"
+    "\xce\x90\x00\x02\xce\x91\x00\x02\xce\x92\x00\x02\xce\x93\x00\x02"
+    "\xce\x94\x00\x02\xce\x95\x00\x02\xce\x96\x00\x02\xce\x97\x00\x02"
+    "\xce\x98\x00\x02\xce\x99\x00\x02\xce\x9a\x00\x02\xce\x9b\x00\x02"
+    "\xce\x9c\x00\x02\xce\x9d\x00\x02\xce\x9e\x00\x02\xce\x9f\x00\x02"
+    "\xce\xa0\x00\x02\xce\xa1\x00\x02\x00\x00\x00\x00\xce\xa3\x00\x02"
+    "\xce\xa4\x00\x02\xce\xa5\x00\x02\xce\xa6\x00\x02\xce\xa7\x00\x02"
+    "\xce\xa8\x00\x02\xce\xa9\x00\x02\xce\xaa\x00\x02\xce\xab\x00\x02"
+    "\xce\xac\x00\x02\xce\xad\x00\x02\xce\xae\x00\x02\xce\xaf\x00\x02"
+    "\xce\xb0\x00\x02\xce\xb1\x00\x02\xce\xb2\x00\x02\xce\xb3\x00\x02"
+    "\xce\xb4\x00\x02\xce\xb5\x00\x02\xce\xb6\x00\x02\xce\xb7\x00\x02"
+    "\xce\xb8\x00\x02\xce\xb9\x00\x02\xce\xba\x00\x02\xce\xbb\x00\x02"
+    "\xce\xbc\x00\x02\xce\xbd\x00\x02\xce\xbe\x00\x02\xce\xbf\x00\x02"
+    "\xcf\x80\x00\x02\xcf\x81\x00\x02\xcf\x82\x00\x02\xcf\x83\x00\x02"
+    "\xcf\x84\x00\x02\xcf\x85\x00\x02\xcf\x86\x00\x02\xcf\x87\x00\x02"
+    "\xcf\x88\x00\x02\xcf\x89\x00\x02\xcf\x8a\x00\x02\xcf\x8b\x00\x02"
+    "\xcf\x8c\x00\x02\xcf\x8d\x00\x02\xcf\x8e\x00\x02\x00\x00\x00\x00"
+};
+
+static unsigned char const xmltranscodetable_ISO8859_7 [48 + 8 * 64] = {
+    "\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x02\x03\x04"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x05\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x80\x81\x82\x83\x84\x85\x86\x87\x88\x89\x8a\x8b\x8c\x8d\x8e\x8f"
+    "\x90\x91\x92\x93\x94\x95\x96\x97\x98\x99\x9a\x9b\x9c\x9d\x9e\x9f"
+    "\xa0\x00\x00\xa3\x00\x00\xa6\xa7\xa8\xa9\x00\xab\xac\xad\x00\x00"
+    "\xb0\xb1\xb2\xb3\x00\x00\x00\xb7\x00\x00\x00\xbb\x00\xbd\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xaa\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\xb4\xb5\xb6\x00\xb8\xb9\xba\x00\xbc\x00\xbe\xbf"
+    "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8\xc9\xca\xcb\xcc\xcd\xce\xcf"
+    "\xd0\xd1\x00\xd3\xd4\xd5\xd6\xd7\xd8\xd9\xda\xdb\xdc\xdd\xde\xdf"
+    "\xe0\xe1\xe2\xe3\xe4\xe5\xe6\xe7\xe8\xe9\xea\xeb\xec\xed\xee\xef"
+    "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x06\x00\x07\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\xaf\x00\x00\xa1\xa2\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xa4\x00\x00\xa5"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+const encodingCodepage encodingISO8859_7 = {
+    "ISO-8859-7", xmlunicodetable_ISO8859_7, xmlutf8table_ISO8859_7, xmltranscodetable_ISO8859_7, 0x00
+};
+
+
+/* ISO-8859-15, Latin-9, Western European with the euro sign */
+static unsigned short const xmlunicodetable_ISO8859_15 [128] = {
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+    0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
+    0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x20ac, 0x00a5, 0x0160, 0x00a7,
+    0x0161, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+    0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x017d, 0x00b5, 0x00b6, 0x00b7,
+    0x017e, 0x00b9, 0x00ba, 0x00bb, 0x0152, 0x0153, 0x0178, 0x00bf,
+    0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+    0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+    0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+    0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+    0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+    0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+    0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+    0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+};
+
+static unsigned char const xmlutf8table_ISO8859_15 [128 * 4] = {
+    "\xc2\x80\x00\x02\xc2\x81\x00\x02\xc2\x82\x00\x02\xc2\x83\x00\x02"
+    "\xc2\x84\x00\x02\xc2\x85\x00\x02\xc2\x86\x00\x02\xc2\x87\x00\x02"
+    "\xc2\x88\x00\x02\xc2\x89\x00\x02\xc2\x8a\x00\x02\xc2\x8b\x00\x02"
+    "\xc2\x8c\x00\x02\xc2\x8d\x00\x02\xc2\x8e\x00\x02\xc2\x8f\x00\x02"
+    "\xc2\x90\x00\x02\xc2\x91\x00\x02\xc2\x92\x00\x02\xc2\x93\x00\x02"
+    "\xc2\x94\x00\x02\xc2\x95\x00\x02\xc2\x96\x00\x02\xc2\x97\x00\x02"
+    "\xc2\x98\x00\x02\xc2\x99\x00\x02\xc2\x9a\x00\x02\xc2\x9b\x00\x02"
+    "\xc2\x9c\x00\x02\xc2\x9d\x00\x02\xc2\x9e\x00\x02\xc2\x9f\x00\x02"
+    "\xc2\xa0\x00\x02\xc2\xa1\x00\x02\xc2\xa2\x00\x02\xc2\xa3\x00\x02"
+    "\xe2\x82\xac\x03\xc2\xa5\x00\x02\xc5\xa0\x00\x02\xc2\xa7\x00\x02"
+    "\xc5\xa1\x00\x02\xc2\xa9\x00\x02\xc2\xaa\x00\x02\xc2\xab\x00\x02"
+    "\xc2\xac\x00\x02\xc2\xad\x00\x02\xc2\xae\x00\x02\xc2\xaf\x00\x02"
+    "\xc2\xb0\x00\x02\xc2\xb1\x00\x02\xc2\xb2\x00\x02\xc2\xb3\x00\x02"
+    "\xc5\xbd\x00\x02\xc2\xb5\x00\x02\xc2\xb6\x00\x02\xc2\xb7\x00\x02"
+    "\xc5\xbe\x00\x02\xc2\xb9\x00\x02\xc2\xba\x00\x02\xc2\xbb\x00\x02"
+    "\xc5\x92\x00\x02\xc5\x93\x00\x02\xc5\xb8\x00\x02\xc2\xbf\x00\x02"
+    "\xc3\x80\x00\x02\xc3\x81\x00\x02\xc3\x82\x00\x02\xc3\x83\x00\x02"
+    "\xc3\x84\x00\x02\xc3\x85\x00\x02\xc3\x86\x00\x02\xc3\x87\x00\x02"
+    "\xc3\x88\x00\x02\xc3\x89\x00\x02\xc3\x8a\x00\x02\xc3\x8b\x00\x02"
+    "\xc3\x8c\x00\x02\xc3\x8d\x00\x02\xc3\x8e\x00\x02\xc3\x8f\x00\x02"
+    "\xc3\x90\x00\x02\xc3\x91\x00\x02\xc3\x92\x00\x02\xc3\x93\x00\x02"
+    "\xc3\x94\x00\x02\xc3\x95\x00\x02\xc3\x96\x00\x02\xc3\x97\x00\x02"
+    "\xc3\x98\x00\x02\xc3\x99\x00\x02\xc3\x9a\x00\x02\xc3\x9b\x00\x02"
+    "\xc3\x9c\x00\x02\xc3\x9d\x00\x02\xc3\x9e\x00\x02\xc3\x9f\x00\x02"
+    "\xc3\xa0\x00\x02\xc3\xa1\x00\x02\xc3\xa2\x00\x02\xc3\xa3\x00\x02"
+    "\xc3\xa4\x00\x02\xc3\xa5\x00\x02\xc3\xa6\x00\x02\xc3\xa7\x00\x02"
+    "\xc3\xa8\x00\x02\xc3\xa9\x00\x02\xc3\xaa\x00\x02\xc3\xab\x00\x02"
+    "\xc3\xac\x00\x02\xc3\xad\x00\x02\xc3\xae\x00\x02\xc3\xaf\x00\x02"
+    "\xc3\xb0\x00\x02\xc3\xb1\x00\x02\xc3\xb2\x00\x02\xc3\xb3\x00\x02"
+    "\xc3\xb4\x00\x02\xc3\xb5\x00\x02\xc3\xb6\x00\x02\xc3\xb7\x00\x02"
+    "\xc3\xb8\x00\x02\xc3\xb9\x00\x02\xc3\xba\x00\x02\xc3\xbb\x00\x02"
+    "\xc3\xbc\x00\x02\xc3\xbd\x00\x02\xc3\xbe\x00\x02\xc3\xbf\x00\x02"
+};
+
+static unsigned char const xmltranscodetable_ISO8859_15 [48 + 6 * 64] = {
+    "\x00\x00\x01\x02\x00\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x80\x81\x82\x83\x84\x85\x86\x87\x88\x89\x8a\x8b\x8c\x8d\x8e\x8f"
+    "\x90\x91\x92\x93\x94\x95\x96\x97\x98\x99\x9a\x9b\x9c\x9d\x9e\x9f"
+    "\xa0\xa1\xa2\xa3\x00\xa5\x00\xa7\x00\xa9\xaa\xab\xac\xad\xae\xaf"
+    "\xb0\xb1\xb2\xb3\x00\xb5\xb6\xb7\x00\xb9\xba\xbb\x00\x00\x00\xbf"
+    "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8\xc9\xca\xcb\xcc\xcd\xce\xcf"
+    "\xd0\xd1\xd2\xd3\xd4\xd5\xd6\xd7\xd8\xd9\xda\xdb\xdc\xdd\xde\xdf"
+    "\xe0\xe1\xe2\xe3\xe4\xe5\xe6\xe7\xe8\xe9\xea\xeb\xec\xed\xee\xef"
+    "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\xbc\xbd\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\xa6\xa8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\xbe\x00\x00\x00\x00\xb4\xb8\x00"
+    "\x00\x00\x05\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xa4\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+const encodingCodepage encodingISO8859_15 = {
+    "ISO-8859-15", xmlunicodetable_ISO8859_15, xmlutf8table_ISO8859_15, xmltranscodetable_ISO8859_15, 0x00
+};
+
+
+/* windows-1250, Central European */
+static unsigned short const xmlunicodetable_Cp1250 [128] = {
+    0x20ac, 0x0000, 0x201a, 0x0000, 0x201e, 0x2026, 0x2020, 0x2021,
+    0x0000, 0x2030, 0x0160, 0x2039, 0x015a, 0x0164, 0x017d, 0x0179,
+    0x0000, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+    0x0000, 0x2122, 0x0161, 0x203a, 0x015b, 0x0165, 0x017e, 0x017a,
+    0x00a0, 0x02c7, 0x02d8, 0x0141, 0x00a4, 0x0104, 0x00a6, 0x00a7,
+    0x00a8, 0x00a9, 0x015e, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x017b,
+    0x00b0, 0x00b1, 0x02db, 0x0142, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+    0x00b8, 0x0105, 0x015f, 0x00bb, 0x013d, 0x02dd, 0x013e, 0x017c,
+    0x0154, 0x00c1, 0x00c2, 0x0102, 0x00c4, 0x0139, 0x0106, 0x00c7,
+    0x010c, 0x00c9, 0x0118, 0x00cb, 0x011a, 0x00cd, 0x00ce, 0x010e,
+    0x0110, 0x0143, 0x0147, 0x00d3, 0x00d4, 0x0150, 0x00d6, 0x00d7,
+    0x0158, 0x016e, 0x00da, 0x0170, 0x00dc, 0x00dd, 0x0162, 0x00df,
+    0x0155, 0x00e1, 0x00e2, 0x0103, 0x00e4, 0x013a, 0x0107, 0x00e7,
+    0x010d, 0x00e9, 0x0119, 0x00eb, 0x011b, 0x00ed, 0x00ee, 0x010f,
+    0x0111, 0x0144, 0x0148, 0x00f3, 0x00f4, 0x0151, 0x00f6, 0x00f7,
+    0x0159, 0x016f, 0x00fa, 0x0171, 0x00fc, 0x00fd, 0x0163, 0x02d9,
+};
+
+static unsigned char const xmlutf8table_Cp1250 [128 * 4] = {
+    "\xe2\x82\xac\x03\x00\x00\x00\x00\xe2\x80\x9a\x03\x00\x00\x00\x00"
+    "\xe2\x80\x9e\x03\xe2\x80\xa6\x03\xe2\x80\xa0\x03\xe2\x80\xa1\x03"
+    "\x00\x00\x00\x00\xe2\x80\xb0\x03\xc5\xa0\x00\x02\xe2\x80\xb9\x03"
+    "\xc5\x9a\x00\x02\xc5\xa4\x00\x02\xc5\xbd\x00\x02\xc5\xb9\x00\x02"
+    "\x00\x00\x00\x00\xe2\x80\x98\x03\xe2\x80\x99\x03\xe2\x80\x9c\x03"
+    "\xe2\x80\x9d\x03\xe2\x80\xa2\x03\xe2\x80\x93\x03\xe2\x80\x94\x03"
+    "\x00\x00\x00\x00\xe2\x84\xa2\x03\xc5\xa1\x00\x02\xe2\x80\xba\x03"
+    "\xc5\x9b\x00\x02\xc5\xa5\x00\x02\xc5\xbe\x00\x02\xc5\xba\x00\x02"
+    "\xc2\xa0\x00\x02\xcb\x87\x00\x02\xcb\x98\x00\x02\xc5\x81\x00\x02"
+    "\xc2\xa4\x00\x02\xc4\x84\x00\x02\xc2\xa6\x00\x02\xc2\xa7\x00\x02"
+    "\xc2\xa8\x00\x02\xc2\xa9\x00\x02\xc5\x9e\x00\x02\xc2\xab\x00\x02"
+    "\xc2\xac\x00\x02\xc2\xad\x00\x02\xc2\xae\x00\x02\xc5\xbb\x00\x02"
+    "\xc2\xb0\x00\x02\xc2\xb1\x00\x02\xcb\x9b\x00\x02\xc5\x82\x00\x02"
+    "\xc2\xb4\x00\x02\xc2\xb5\x00\x02\xc2\xb6\x00\x02\xc2\xb7\x00\x02"
+    "\xc2\xb8\x00\x02\xc4\x85\x00\x02\xc5\x9f\x00\x02\xc2\xbb\x00\x02"
+    "\xc4\xbd\x00\x02\xcb\x9d\x00\x02\xc4\xbe\x00\x02\xc5\xbc\x00\x02"
+    "\xc5\x94\x00\x02\xc3\x81\x00\x02\xc3\x82\x00\x02\xc4\x82\x00\x02"
+    "\xc3\x84\x00\x02\xc4\xb9\x00\x02\xc4\x86\x00\x02\xc3\x87\x00\x02"
+    "\xc4\x8c\x00\x02\xc3\x89\x00\x02\xc4\x98\x00\x02\xc3\x8b\x00\x02"
+    "\xc4\x9a\x00\x02\xc3\x8d\x00\x02\xc3\x8e\x00\x02\xc4\x8e\x00\x02"
+    "\xc4\x90\x00\x02\xc5\x83\x00\x02\xc5\x87\x00\x02\xc3\x93\x00\x02"
+    "\xc3\x94\x00\x02\xc5\x90\x00\x02\xc3\x96\x00\x02\xc3\x97\x00\x02"
+    "\xc5\x98\x00\x02\xc5\xae\x00\x02\xc3\x9a\x00\x02\xc5\xb0\x00\x02"
+    "\xc3\x9c\x00\x02\xc3\x9d\x00\x02\xc5\xa2\x00\x02\xc3\x9f\x00\x02"
+    "\xc5\x95\x00\x02\xc3\xa1\x00\x02\xc3\xa2\x00\x02\xc4\x83\x00\x02"
+    "\xc3\xa4\x00\x02\xc4\xba\x00\x02\xc4\x87\x00\x02\xc3\xa7\x00\x02"
+    "\xc4\x8d\x00\x02\xc3\xa9\x00\x02\xc4\x99\x00\x02\xc3\xab\x00\x02"
+    "\xc4\x9b\x00\x02\xc3\xad\x00\x02\xc3\xae\x00\x02\xc4\x8f\x00\x02"
+    "\xc4\x91\x00\x02\xc5\x84\x00\x02\xc5\x88\x00\x02\xc3\xb3\x00\x02"
+    "\xc3\xb4\x00\x02\xc5\x91\x00\x02\xc3\xb6\x00\x02\xc3\xb7\x00\x02"
+    "\xc5\x99\x00\x02\xc5\xaf\x00\x02\xc3\xba\x00\x02\xc5\xb1\x00\x02"
+    "\xc3\xbc\x00\x02\xc3\xbd\x00\x02\xc5\xa3\x00\x02\xcb\x99\x00\x02"
+};
+
+static unsigned char const xmltranscodetable_Cp1250 [48 + 10 * 64] = {
+    "\x00\x00\x01\x02\x03\x04\x00\x00\x00\x00\x00\x05\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x06\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\xa0\x00\x00\x00\xa4\x00\xa6\xa7\xa8\xa9\x00\xab\xac\xad\xae\x00"
+    "\xb0\xb1\x00\x00\xb4\xb5\xb6\xb7\xb8\x00\x00\xbb\x00\x00\x00\x00"
+    "\x00\xc1\xc2\x00\xc4\x00\x00\xc7\x00\xc9\x00\xcb\x00\xcd\xce\x00"
+    "\x00\x00\x00\xd3\xd4\x00\xd6\xd7\x00\x00\xda\x00\xdc\xdd\x00\xdf"
+    "\x00\xe1\xe2\x00\xe4\x00\x00\xe7\x00\xe9\x00\xeb\x00\xed\xee\x00"
+    "\x00\x00\x00\xf3\xf4\x00\xf6\xf7\x00\x00\xfa\x00\xfc\xfd\x00\x00"
+    "\x00\x00\xc3\xe3\xa5\xb9\xc6\xe6\x00\x00\x00\x00\xc8\xe8\xcf\xef"
+    "\xd0\xf0\x00\x00\x00\x00\x00\x00\xca\xea\xcc\xec\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\xc5\xe5\x00\x00\xbc\xbe\x00"
+    "\x00\xa3\xb3\xd1\xf1\x00\x00\xd2\xf2\x00\x00\x00\x00\x00\x00\x00"
+    "\xd5\xf5\x00\x00\xc0\xe0\x00\x00\xd8\xf8\x8c\x9c\x00\x00\xaa\xba"
+    "\x8a\x9a\xde\xfe\x8d\x9d\x00\x00\x00\x00\x00\x00\x00\x00\xd9\xf9"
+    "\xdb\xfb\x00\x00\x00\x00\x00\x00\x00\x8f\x9f\xaf\xbf\x8e\x9e\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\xa1\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\xa2\xff\x00\xb2\x00\xbd\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x07\x00\x08\x00\x09\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x96\x97\x00\x00\x00\x91\x92\x82\x00\x93\x94\x84\x00"
+    "\x86\x87\x95\x00\x00\x00\x85\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x89\x00\x00\x00\x00\x00\x00\x00\x00\x8b\x9b\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x99\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+const encodingCodepage encodingCp1250 = {
+    "windows-1250", xmlunicodetable_Cp1250, xmlutf8table_Cp1250, xmltranscodetable_Cp1250, 0x00
+};
+
+
+/* windows-1251, Cyrillic */
+static unsigned short const xmlunicodetable_Cp1251 [128] = {
+    0x0402, 0x0403, 0x201a, 0x0453, 0x201e, 0x2026, 0x2020, 0x2021,
+    0x20ac, 0x2030, 0x0409, 0x2039, 0x040a, 0x040c, 0x040b, 0x040f,
+    0x0452, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+    0x0000, 0x2122, 0x0459, 0x203a, 0x045a, 0x045c, 0x045b, 0x045f,
+    0x00a0, 0x040e, 0x045e, 0x0408, 0x00a4, 0x0490, 0x00a6, 0x00a7,
+    0x0401, 0x00a9, 0x0404, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x0407,
+    0x00b0, 0x00b1, 0x0406, 0x0456, 0x0491, 0x00b5, 0x00b6, 0x00b7,
+    0x0451, 0x2116, 0x0454, 0x00bb, 0x0458, 0x0405, 0x0455, 0x0457,
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+    0x0418, 0x0419, 0x041a, 0x041b, 0x041c, 0x041d, 0x041e, 0x041f,
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+    0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d, 0x042e, 0x042f,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+    0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f,
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+    0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e, 0x044f,
+};
+
+static unsigned char const xmlutf8table_Cp1251 [128 * 4] = {
+    "\xd0\x82\x00\x02\xd0\x83\x00\x02\xe2\x80\x9a\x03\xd1\x93\x00\x02"
+    "\xe2\x80\x9e\x03\xe2\x80\xa6\x03\xe2\x80\xa0\x03\xe2\x80\xa1\x03"
+    "\xe2\x82\xac\x03\xe2\x80\xb0\x03\xd0\x89\x00\x02\xe2\x80\xb9\x03"
+    "\xd0\x8a\x00\x02\xd0\x8c\x00\x02\xd0\x8b\x00\x02\xd0\x8f\x00\x02"
+    "\xd1\x92\x00\x02\xe2\x80\x98\x03\xe2\x80\x99\x03\xe2\x80\x9c\x03"
+    "\xe2\x80\x9d\x03\xe2\x80\xa2\x03\xe2\x80\x93\x03\xe2\x80\x94\x03"
+    "\x00\x00\x00\x00\xe2\x84\xa2\x03\xd1\x99\x00\x02\xe2\x80\xba\x03"
+    "\xd1\x9a\x00\x02\xd1\x9c\x00\x02\xd1\x9b\x00\x02\xd1\x9f\x00\x02"
+    "\xc2\xa0\x00\x02\xd0\x8e\x00\x02\xd1\x9e\x00\x02\xd0\x88\x00\x02"
+    "\xc2\xa4\x00\x02\xd2\x90\x00\x02\xc2\xa6\x00\x02\xc2\xa7\x00\x02"
+    "\xd0\x81\x00\x02\xc2\xa9\x00\x02\xd0\x84\x00\x02\xc2\xab\x00\x02"
+    "\xc2\xac\x00\x02\xc2\xad\x00\x02\xc2\xae\x00\x02\xd0\x87\x00\x02"
+    "\xc2\xb0\x00\x02\xc2\xb1\x00\x02\xd0\x86\x00\x02\xd1\x96\x00\x02"
+    "\xd2\x91\x00\x02\xc2\xb5\x00\x02\xc2\xb6\x00\x02\xc2\xb7\x00\x02"
+    "\xd1\x91\x00\x02\xe2\x84\x96\x03\xd1\x94\x00\x02\xc2\xbb\x00\x02"
+    "\xd1\x98\x00\x02\xd0\x85\x00\x02\xd1\x95\x00\x02\xd1\x97\x00\x02"
+    "\xd0\x90\x00\x02\xd0\x91\x00\x02\xd0\x92\x00\x02\xd0\x93\x00\x02"
+    "\xd0\x94\x00\x02\xd0\x95\x00\x02\xd0\x96\x00\x02\xd0\x97\x00\x02"
+    "\xd0\x98\x00\x02\xd0\x99\x00\x02\xd0\x9a\x00\x02\xd0\x9b\x00\x02"
+    "\xd0\x9c\x00\x02\xd0\x9d\x00\x02\xd0\x9e\x00\x02\xd0\x9f\x00\x02"
+    "\xd0\xa0\x00\x02\xd0\xa1\x00\x02\xd0\xa2\x00\x02\xd0\xa3\x00\x02"
+    "\xd0\xa4\x00\x02\xd0\xa5\x00\x02\xd0\xa6\x00\x02\xd0\xa7\x00\x02"
+    "\xd0\xa8\x00\x02\xd0\xa9\x00\x02\xd0\xaa\x00\x02\xd0\xab\x00\x02"
+    "\xd0\xac\x00\x02\xd0\xad\x00\x02\xd0\xae\x00\x02\xd0\xaf\x00\x02"
+    "\xd0\xb0\x00\x02\xd0\xb1\x00\x02\xd0\xb2\x00\x02\xd0\xb3\x00\x02"
+    "\xd0\xb4\x00\x02\xd0\xb5\x00\x02\xd0\xb6\x00\x02\xd0\xb7\x00\x02"
+    "\xd0\xb8\x00\x02\xd0\xb9\x00\x02\xd0\xba\x00\x02\xd0\xbb\x00\x02"
+    "\xd0\xbc\x00\x02\xd0\xbd\x00\x02\xd0\xbe\x00\x02\xd0\xbf\x00\x02"
+    "\xd1\x80\x00\x02\xd1\x81\x00\x02\xd1\x82\x00\x02\xd1\x83\x00\x02"
+    "\xd1\x84\x00\x02\xd1\x85\x00\x02\xd1\x86\x00\x02\xd1\x87\x00\x02"
+    "\xd1\x88\x00\x02\xd1\x89\x00\x02\xd1\x8a\x00\x02\xd1\x8b\x00\x02"
+    "\xd1\x8c\x00\x02\xd1\x8d\x00\x02\xd1\x8e\x00\x02\xd1\x8f\x00\x02"
+};
+
+static unsigned char const xmltranscodetable_Cp1251 [48 + 9 * 64] = {
+    "\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x02\x03\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x05\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\xa0\x00\x00\x00\xa4\x00\xa6\xa7\x00\xa9\x00\xab\xac\xad\xae\x00"
+    "\xb0\xb1\x00\x00\x00\xb5\xb6\xb7\x00\x00\x00\xbb\x00\x00\x00\x00"
+    "\x00\xa8\x80\x81\xaa\xbd\xb2\xaf\xa3\x8a\x8c\x8e\x8d\x00\xa1\x8f"
+    "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8\xc9\xca\xcb\xcc\xcd\xce\xcf"
+    "\xd0\xd1\xd2\xd3\xd4\xd5\xd6\xd7\xd8\xd9\xda\xdb\xdc\xdd\xde\xdf"
+    "\xe0\xe1\xe2\xe3\xe4\xe5\xe6\xe7\xe8\xe9\xea\xeb\xec\xed\xee\xef"
+    "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff"
+    "\x00\xb8\x90\x83\xba\xbe\xb3\xbf\xbc\x9a\x9c\x9e\x9d\x00\xa2\x9f"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\xa5\xb4\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x06\x00\x07\x00\x08\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x96\x97\x00\x00\x00\x91\x92\x82\x00\x93\x94\x84\x00"
+    "\x86\x87\x95\x00\x00\x00\x85\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x89\x00\x00\x00\x00\x00\x00\x00\x00\x8b\x9b\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x88\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\xb9\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x99\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+const encodingCodepage encodingCp1251 = {
+    "windows-1251", xmlunicodetable_Cp1251, xmlutf8table_Cp1251, xmltranscodetable_Cp1251, 0x00
+};
+
+
+/* windows-1253, Greek */
+static unsigned short const xmlunicodetable_Cp1253 [128] = {
+    0x20ac, 0x0000, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+    0x0000, 0x2030, 0x0000, 0x2039, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+    0x0000, 0x2122, 0x0000, 0x203a, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00a0, 0x0385, 0x0386, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+    0x00a8, 0x00a9, 0x0000, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x2015,
+    0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x0384, 0x00b5, 0x00b6, 0x00b7,
+    0x0388, 0x0389, 0x038a, 0x00bb, 0x038c, 0x00bd, 0x038e, 0x038f,
+    0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+    0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f,
+    0x03a0, 0x03a1, 0x0000, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7,
+    0x03a8, 0x03a9, 0x03aa, 0x03ab, 0x03ac, 0x03ad, 0x03ae, 0x03af,
+    0x03b0, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7,
+    0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf,
+    0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+    0x03c8, 0x03c9, 0x03ca, 0x03cb, 0x03cc, 0x03cd, 0x03ce, 0x0000,
+};
+
+static unsigned char const xmlutf8table_Cp1253 [128 * 4] = {
+    "\xe2\x82\xac\x03\x00\x00\x00\x00\xe2\x80\x9a\x03\xc6\x92\x00\x02"
+    "\xe2\x80\x9e\x03\xe2\x80\xa6\x03\xe2\x80\xa0\x03\xe2\x80\xa1\x03"
+    "\x00\x00\x00\x00\xe2\x80\xb0\x03\x00\x00\x00\x00\xe2\x80\xb9\x03"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\xe2\x80\x98\x03\xe2\x80\x99\x03\xe2\x80\x9c\x03"
+    "\xe2\x80\x9d\x03\xe2\x80\xa2\x03\xe2\x80\x93\x03\xe2\x80\x94\x03"
+    "\x00\x00\x00\x00\xe2\x84\xa2\x03\x00\x00\x00\x00\xe2\x80\xba\x03"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\xc2\xa0\x00\x02\xce\x85\x00\x02\xce\x86\x00\x02\xc2\xa3\x00\x02"
+    "\xc2\xa4\x00\x02\xc2\xa5\x00\x02\xc2\xa6\x00\x02\xc2\xa7\x00\x02"
+    "\xc2\xa8\x00\x02\xc2\xa9\x00\x02\x00\x00\x00\x00\xc2\xab\x00\x02"
+    "\xc2\xac\x00\x02\xc2\xad\x00\x02\xc2\xae\x00\x02\xe2\x80\x95\x03"
+    "\xc2\xb0\x00\x02\xc2\xb1\x00\x02\xc2\xb2\x00\x02\xc2\xb3\x00\x02"
+    "\xce\x84\x00\x02\xc2\xb5\x00\x02\xc2\xb6\x00\x02\xc2\xb7\x00\x02"
+    "\xce\x88\x00\x02\xce\x89\x00\x02\xce\x8a\x00\x02\xc2\xbb\x00\x02"
+    "\xce\x8c\x00\x02\xc2\xbd\x00\x02\xce\x8e\x00\x02\xce\x8f\x00\x02"
+    "\xce\x90\x00\x02\xce\x91\x00\x02\xce\x92\x00\x02\xce\x93\x00\x02"
+    "\xce\x94\x00\x02\xce\x95\x00\x02\xce\x96\x00\x02\xce\x97\x00\x02"
+    "\xce\x98\x00\x02\xce\x99\x00\x02\xce\x9a\x00\x02\xce\x9b\x00\x02"
+    "\xce\x9c\x00\x02\xce\x9d\x00\x02\xce\x9e\x00\x02\xce\x9f\x00\x02"
+    "\xce\xa0\x00\x02\xce\xa1\x00\x02\x00\x00\x00\x00\xce\xa3\x00\x02"
+    "\xce\xa4\x00\x02\xce\xa5\x00\x02\xce\xa6\x00\x02\xce\xa7\x00\x02"
+    "\xce\xa8\x00\x02\xce\xa9\x00\x02\xce\xaa\x00\x02\xce\xab\x00\x02"
+    "\xce\xac\x00\x02\xce\xad\x00\x02\xce\xae\x00\x02\xce\xaf\x00\x02"
+    "\xce\xb0\x00\x02\xce\xb1\x00\x02\xce\xb2\x00\x02\xce\xb3\x00\x02"
+    "\xce\xb4\x00\x02\xce\xb5\x00\x02\xce\xb6\x00\x02\xce\xb7\x00\x02"
+    "\xce\xb8\x00\x02\xce\xb9\x00\x02\xce\xba\x00\x02\xce\xbb\x00\x02"
+    "\xce\xbc\x00\x02\xce\xbd\x00\x02\xce\xbe\x00\x02\xce\xbf\x00\x02"
+    "\xcf\x80\x00\x02\xcf\x81\x00\x02\xcf\x82\x00\x02\xcf\x83\x00\x02"
+    "\xcf\x84\x00\x02\xcf\x85\x00\x02\xcf\x86\x00\x02\xcf\x87\x00\x02"
+    "\xcf\x88\x00\x02\xcf\x89\x00\x02\xcf\x8a\x00\x02\xcf\x8b\x00\x02"
+    "\xcf\x8c\x00\x02\xcf\x8d\x00\x02\xcf\x8e\x00\x02\x00\x00\x00\x00"
+};
+
+static unsigned char const xmltranscodetable_Cp1253 [48 + 9 * 64] = {
+    "\x00\x00\x01\x00\x00\x00\x02\x00\x00\x00\x00\x00\x00\x00\x03\x04"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x05\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\xa0\x00\x00\xa3\xa4\xa5\xa6\xa7\xa8\xa9\x00\xab\xac\xad\xae\x00"
+    "\xb0\xb1\xb2\xb3\x00\xb5\xb6\xb7\x00\x00\x00\xbb\x00\xbd\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x83\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\xb4\xa1\xa2\x00\xb8\xb9\xba\x00\xbc\x00\xbe\xbf"
+    "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8\xc9\xca\xcb\xcc\xcd\xce\xcf"
+    "\xd0\xd1\x00\xd3\xd4\xd5\xd6\xd7\xd8\xd9\xda\xdb\xdc\xdd\xde\xdf"
+    "\xe0\xe1\xe2\xe3\xe4\xe5\xe6\xe7\xe8\xe9\xea\xeb\xec\xed\xee\xef"
+    "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x06\x00\x07\x00\x08\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x96\x97\xaf\x00\x00\x91\x92\x82\x00\x93\x94\x84\x00"
+    "\x86\x87\x95\x00\x00\x00\x85\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x89\x00\x00\x00\x00\x00\x00\x00\x00\x8b\x9b\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x99\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+const encodingCodepage encodingCp1253 = {
+    "windows-1253", xmlunicodetable_Cp1253, xmlutf8table_Cp1253, xmltranscodetable_Cp1253, 0x00
+};
+
+
+/* windows-1252, Western European */
+static unsigned short const xmlunicodetable_Cp1252 [128] = {
+    0x20ac, 0x0081, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+    0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008d, 0x017d, 0x008f,
+    0x0090, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+    0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0x009d, 0x017e, 0x0178,
+    0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7,
+    0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
+    0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7,
+    0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
+    0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
+    0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
+    0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
+    0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
+    0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
+    0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
+    0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
+    0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
+};
+
+static unsigned char const xmlutf8table_Cp1252 [128 * 4] = {
+    "\xe2\x82\xac\x03\xc2\x81\x00\x02\xe2\x80\x9a\x03\xc6\x92\x00\x02"
+    "\xe2\x80\x9e\x03\xe2\x80\xa6\x03\xe2\x80\xa0\x03\xe2\x80\xa1\x03"
+    "\xcb\x86\x00\x02\xe2\x80\xb0\x03\xc5\xa0\x00\x02\xe2\x80\xb9\x03"
+    "\xc5\x92\x00\x02\xc2\x8d\x00\x02\xc5\xbd\x00\x02\xc2\x8f\x00\x02"
+    "\xc2\x90\x00\x02\xe2\x80\x98\x03\xe2\x80\x99\x03\xe2\x80\x9c\x03"
+    "\xe2\x80\x9d\x03\xe2\x80\xa2\x03\xe2\x80\x93\x03\xe2\x80\x94\x03"
+    "\xcb\x9c\x00\x02\xe2\x84\xa2\x03\xc5\xa1\x00\x02\xe2\x80\xba\x03"
+    "\xc5\x93\x00\x02\xc2\x9d\x00\x02\xc5\xbe\x00\x02\xc5\xb8\x00\x02"
+    "\xc2\xa0\x00\x02\xc2\xa1\x00\x02\xc2\xa2\x00\x02\xc2\xa3\x00\x02"
+    "\xc2\xa4\x00\x02\xc2\xa5\x00\x02\xc2\xa6\x00\x02\xc2\xa7\x00\x02"
+    "\xc2\xa8\x00\x02\xc2\xa9\x00\x02\xc2\xaa\x00\x02\xc2\xab\x00\x02"
+    "\xc2\xac\x00\x02\xc2\xad\x00\x02\xc2\xae\x00\x02\xc2\xaf\x00\x02"
+    "\xc2\xb0\x00\x02\xc2\xb1\x00\x02\xc2\xb2\x00\x02\xc2\xb3\x00\x02"
+    "\xc2\xb4\x00\x02\xc2\xb5\x00\x02\xc2\xb6\x00\x02\xc2\xb7\x00\x02"
+    "\xc2\xb8\x00\x02\xc2\xb9\x00\x02\xc2\xba\x00\x02\xc2\xbb\x00\x02"
+    "\xc2\xbc\x00\x02\xc2\xbd\x00\x02\xc2\xbe\x00\x02\xc2\xbf\x00\x02"
+    "\xc3\x80\x00\x02\xc3\x81\x00\x02\xc3\x82\x00\x02\xc3\x83\x00\x02"
+    "\xc3\x84\x00\x02\xc3\x85\x00\x02\xc3\x86\x00\x02\xc3\x87\x00\x02"
+    "\xc3\x88\x00\x02\xc3\x89\x00\x02\xc3\x8a\x00\x02\xc3\x8b\x00\x02"
+    "\xc3\x8c\x00\x02\xc3\x8d\x00\x02\xc3\x8e\x00\x02\xc3\x8f\x00\x02"
+    "\xc3\x90\x00\x02\xc3\x91\x00\x02\xc3\x92\x00\x02\xc3\x93\x00\x02"
+    "\xc3\x94\x00\x02\xc3\x95\x00\x02\xc3\x96\x00\x02\xc3\x97\x00\x02"
+    "\xc3\x98\x00\x02\xc3\x99\x00\x02\xc3\x9a\x00\x02\xc3\x9b\x00\x02"
+    "\xc3\x9c\x00\x02\xc3\x9d\x00\x02\xc3\x9e\x00\x02\xc3\x9f\x00\x02"
+    "\xc3\xa0\x00\x02\xc3\xa1\x00\x02\xc3\xa2\x00\x02\xc3\xa3\x00\x02"
+    "\xc3\xa4\x00\x02\xc3\xa5\x00\x02\xc3\xa6\x00\x02\xc3\xa7\x00\x02"
+    "\xc3\xa8\x00\x02\xc3\xa9\x00\x02\xc3\xaa\x00\x02\xc3\xab\x00\x02"
+    "\xc3\xac\x00\x02\xc3\xad\x00\x02\xc3\xae\x00\x02\xc3\xaf\x00\x02"
+    "\xc3\xb0\x00\x02\xc3\xb1\x00\x02\xc3\xb2\x00\x02\xc3\xb3\x00\x02"
+    "\xc3\xb4\x00\x02\xc3\xb5\x00\x02\xc3\xb6\x00\x02\xc3\xb7\x00\x02"
+    "\xc3\xb8\x00\x02\xc3\xb9\x00\x02\xc3\xba\x00\x02\xc3\xbb\x00\x02"
+    "\xc3\xbc\x00\x02\xc3\xbd\x00\x02\xc3\xbe\x00\x02\xc3\xbf\x00\x02"
+};
+
+static unsigned char const xmltranscodetable_Cp1252 [48 + 10 * 64] = {
+    "\x00\x00\x01\x02\x00\x03\x04\x00\x00\x00\x00\x05\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x06\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x80\x81\x82\x83\x84\x85\x86\x87\x88\x89\x8a\x8b\x8c\x8d\x8e\x8f"
+    "\x90\x91\x92\x93\x94\x95\x96\x97\x98\x99\x9a\x9b\x9c\x9d\x9e\x9f"
+    "\xa0\xa1\xa2\xa3\xa4\xa5\xa6\xa7\xa8\xa9\xaa\xab\xac\xad\xae\xaf"
+    "\xb0\xb1\xb2\xb3\xb4\xb5\xb6\xb7\xb8\xb9\xba\xbb\xbc\xbd\xbe\xbf"
+    "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8\xc9\xca\xcb\xcc\xcd\xce\xcf"
+    "\xd0\xd1\xd2\xd3\xd4\xd5\xd6\xd7\xd8\xd9\xda\xdb\xdc\xdd\xde\xdf"
+    "\xe0\xe1\xe2\xe3\xe4\xe5\xe6\xe7\xe8\xe9\xea\xeb\xec\xed\xee\xef"
+    "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x8c\x9c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x8a\x9a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x9f\x00\x00\x00\x00\x8e\x9e\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x83\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x88\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x98\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x07\x00\x08\x00\x09\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x96\x97\x00\x00\x00\x91\x92\x82\x00\x93\x94\x84\x00"
+    "\x86\x87\x95\x00\x00\x00\x85\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x89\x00\x00\x00\x00\x00\x00\x00\x00\x8b\x9b\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x99\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+const encodingCodepage encodingCp1252 = {
+    "windows-1252", xmlunicodetable_Cp1252, xmlutf8table_Cp1252, xmltranscodetable_Cp1252, 0xbf
+};
@@ -0,0 +1,291 @@
+/*
+ * cparallel.c - multi-threaded base64 encoding and decoding of large buffers
+ *
+ * Base64 maps every 3 byte group to 4 characters on its own, so a large
+ * buffer can be cut into shards that are encoded or decoded
+ * independently, provided the cuts fall on group (and line) boundaries
+ * on the encoded side. The output position of every shard is known up
+ * front, so shards write straight into the caller's buffer.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+
+#include "cparallel.h"
+#include "cencode.h"
+#include "cdecode.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <process.h>
+typedef HANDLE worker_thread;
+#define WORKER_FUNC unsigned __stdcall
+#define WORKER_RETURN 0
+#else
+#include <pthread.h>
+typedef pthread_t worker_thread;
+#define WORKER_FUNC void*
+#define WORKER_RETURN NULL
+#endif
+
+#define MAX_THREADS 64
+/* below this much input per thread, starting threads costs more than it saves */
+#define MIN_SHARD (256 * 1024)
+/* keeps decode shards within the int lengths of base64_decode_block */
+#define MAX_SHARD (1 << 30)
+
+enum task_kind { task_encode, task_count, task_decode };
+
+struct task
+{
+    enum task_kind kind;
+    const char* in;
+    size_t length;
+    char* out;
+    size_t count;           /* task_count: result; task_decode: alphabet characters in the shard */
+    int tail;               /* task_decode: shard runs to the end of the input */
+    size_t result;
+};
+
+struct worker
+{
+    struct task* tasks;
+    int ntasks;
+    int first;
+    int step;
+    int chars_per_line;
+    int padding;
+    const base64_alphabet* alphabet;
+};
+
+static size_t count_values(const char* code_in, size_t length_in, const base64_alphabet* alphabet)
+{
+    const uint32_t* const decode = alphabet->decode[3];
+    size_t count = 0;
+    size_t i;
+
+    for (i = 0; i < length_in; i++)
+        count += !(decode[(unsigned char) code_in[i]] & BASE64_BAD_CHAR);
+    return count;
+}
+
+static void run_task(const struct worker* w, struct task* t)
+{
+    switch (t->kind)
+    {
+    case task_encode:
+        t->result = base64_encode(t->in, t->length, t->out, w->chars_per_line, w->alphabet, w->padding);
+        break;
+    case task_count:
+        t->result = count_values(t->in, t->length, w->alphabet);
+        break;
+    case task_decode:
+        if (t->tail || t->length > INT_MAX)
+        {
+            t->result = base64_decode(t->in, t->length, t->out, w->alphabet);
+        }
+        else if (t->count > 0)
+        {
+            /* whole quads only, so the block decoder stops on a quad boundary */
+            base64_decodestate state;
+            base64_init_decodestate(&state);
+            base64_decodestate_set_alphabet(&state, w->alphabet);
+            t->result = base64_decode_block(t->in, (int) t->length, t->out, &state);
+        }
+        break;
+    }
+}
+
+static WORKER_FUNC worker_main(void* arg)
+{
+    const struct worker* w = (const struct worker*) arg;
+    int i;
+
+    for (i = w->first; i < w->ntasks; i += w->step)
+        run_task(w, &w->tasks[i]);
+    return WORKER_RETURN;
+}
+
+/*
+Run the tasks on 'threads' threads, the calling one included. A thread
+that cannot be started has its share run by the caller.
+*/
+static void run_tasks(struct worker* proto, struct task* tasks, int ntasks, int threads)
+{
+    worker_thread handle[MAX_THREADS];
+    struct worker w[MAX_THREADS];
+    int started[MAX_THREADS];
+    int i;
+
+    for (i = 0; i < threads; i++)
+    {
+        w[i] = *proto;
+        w[i].tasks = tasks;
+        w[i].ntasks = ntasks;
+        w[i].first = i;
+        w[i].step = threads;
+    }
+    for (i = 1; i < threads; i++)
+    {
+#if defined(_WIN32)
+        handle[i] = (HANDLE) _beginthreadex(NULL, 0, worker_main, &w[i], 0, NULL);
+        started[i] = (handle[i] != 0);
+#else
+        started[i] = (pthread_create(&handle[i], NULL, worker_main, &w[i]) == 0);
+#endif
+    }
+    worker_main(&w[0]);
+    for (i = 1; i < threads; i++)
+    {
+        if (!started[i])
+        {
+            worker_main(&w[i]);
+            continue;
+        }
+#if defined(_WIN32)
+        WaitForSingleObject(handle[i], INFINITE);
+        CloseHandle(handle[i]);
+#else
+        pthread_join(handle[i], NULL);
+#endif
+    }
+}
+
+static int clamp_threads(size_t length_in, int threads)
+{
+    if (threads > MAX_THREADS)
+        threads = MAX_THREADS;
+    if ((size_t) threads > length_in / MIN_SHARD)
+        threads = (int) (length_in / MIN_SHARD);
+    return threads;
+}
+
+size_t base64_encode_parallel(const char* plaintext_in, size_t length_in, char* code_out, int chars_per_line,
+                              const base64_alphabet* alphabet, int padding, int threads)
+{
+    struct worker proto;
+    struct task* tasks;
+    size_t unit, per, total = 0;
+    int i;
+
+    if (chars_per_line < 0 || chars_per_line % 4 != 0) return 0;
+    threads = clamp_threads(length_in, threads);
+    if (threads <= 1)
+        return base64_encode(plaintext_in, length_in, code_out, chars_per_line, alphabet, padding);
+
+    /* shards start on a line, so every shard but the last ends with one */
+    unit = (chars_per_line > 0) ? 3 * (size_t) (chars_per_line / 4) : 3;
+    per = length_in / threads / unit * unit;
+    if (per == 0 || (tasks = calloc(threads, sizeof(*tasks))) == NULL)
+        return base64_encode(plaintext_in, length_in, code_out, chars_per_line, alphabet, padding);
+
+    for (i = 0; i < threads; i++)
+    {
+        const size_t offset = i * per;
+        tasks[i].kind = task_encode;
+        tasks[i].in = plaintext_in + offset;
+        tasks[i].length = (i == threads - 1) ? length_in - offset : per;
+        tasks[i].out = code_out + base64_encoded_length(offset, chars_per_line, padding);
+    }
+    proto.chars_per_line = chars_per_line;
+    proto.padding = padding;
+    proto.alphabet = alphabet;
+    run_tasks(&proto, tasks, threads, threads);
+
+    for (i = 0; i < threads; i++)
+        total += tasks[i].result;
+    free(tasks);
+    return total;
+}
+
+size_t base64_decode_parallel(const char* code_in, size_t length_in, char* plaintext_out,
+                              const base64_alphabet* alphabet, int threads)
+{
+    struct worker proto;
+    struct task* tasks;
+    size_t* start;
+    size_t* quad;
+    size_t seen = 0, total = 0;
+    int ntasks, i;
+
+    if (alphabet == NULL)
+        alphabet = &base64_alphabet_standard;
+    threads = clamp_threads(length_in, threads);
+    if (threads <= 1)
+        return base64_decode(code_in, length_in, plaintext_out, alphabet);
+
+    ntasks = threads;
+    if ((length_in + MAX_SHARD - 1) / MAX_SHARD > (size_t) ntasks)
+        ntasks = (int) ((length_in + MAX_SHARD - 1) / MAX_SHARD);
+    tasks = calloc(ntasks, sizeof(*tasks));
+    start = calloc(ntasks + 1, sizeof(*start));
+    quad = calloc(ntasks + 1, sizeof(*quad));
+    if (tasks == NULL || start == NULL || quad == NULL)
+    {
+        free(tasks);
+        free(start);
+        free(quad);
+        return base64_decode(code_in, length_in, plaintext_out, alphabet);
+    }
+    proto.chars_per_line = 0;
+    proto.padding = 0;
+    proto.alphabet = alphabet;
+
+    /* pass 1: count the alphabet characters of equal slices */
+    for (i = 0; i < ntasks; i++)
+    {
+        const size_t from = length_in / ntasks * i;
+        const size_t to = (i == ntasks - 1) ? length_in : length_in / ntasks * (i + 1);
+        tasks[i].kind = task_count;
+        tasks[i].in = code_in + from;
+        tasks[i].length = to - from;
+    }
+    run_tasks(&proto, tasks, ntasks, threads);
+
+    /*
+    Move every cut forward to the next quad boundary: past the characters
+    that complete the quad the slice starts in. quad[i] is the number of
+    alphabet characters before cut i, a multiple of 4.
+    */
+    for (i = 0; i < ntasks; i++)
+    {
+        size_t pos = length_in / ntasks * i;
+        size_t need = (4 - (seen & 3)) & 3;
+
+        quad[i] = seen + need;
+        while (need > 0 && pos < length_in)
+        {
+            if (!(alphabet->decode[3][(unsigned char) code_in[pos]] & BASE64_BAD_CHAR))
+                need--;
+            pos++;
+        }
+        start[i] = (need > 0) ? length_in : pos;
+        seen += tasks[i].result;
+    }
+    start[ntasks] = length_in;
+    quad[ntasks] = seen;
+
+    /* pass 2: decode every shard to its place */
+    for (i = 0; i < ntasks; i++)
+    {
+        tasks[i].kind = task_decode;
+        tasks[i].in = code_in + start[i];
+        tasks[i].length = start[i + 1] - start[i];
+        tasks[i].out = plaintext_out + quad[i] / 4 * 3;
+        tasks[i].tail = (start[i + 1] == length_in);
+        tasks[i].count = (quad[i + 1] > quad[i]) ? quad[i + 1] - quad[i] : 0;
+        tasks[i].result = 0;
+        if (tasks[i].length == 0)
+            tasks[i].tail = 0;
+    }
+    run_tasks(&proto, tasks, ntasks, threads);
+
+    for (i = 0; i < ntasks; i++)
+        total += tasks[i].result;
+    free(tasks);
+    free(start);
+    free(quad);
+    return total;
+}
@@ -0,0 +1,42 @@
+/*
+ * cparallel.h - multi-threaded base64 encoding and decoding of large buffers
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#ifndef BASE64_CPARALLEL_H
+#define BASE64_CPARALLEL_H
+
+#include <stddef.h>
+
+#include "calphabet.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Same as base64_encode, using up to 'threads' threads. The input is cut
+on whole output lines (whole 3 byte groups without wrapping) and every
+thread writes straight to its place in code_out, so the output is byte
+for byte that of base64_encode.
+*/
+size_t base64_encode_parallel(const char* plaintext_in, size_t length_in, char* code_out, int chars_per_line,
+                              const base64_alphabet* alphabet, int padding, int threads);
+
+/*
+Same as base64_decode, using up to 'threads' threads. The alphabet
+characters are counted in parallel first, then the input is cut on quad
+boundaries (line breaks and other skipped characters may sit anywhere)
+and every thread decodes straight to its place in plaintext_out. Unlike
+base64_decode this cannot decode in place: a shard's output overlaps the
+input of the shard before it.
+*/
+size_t base64_decode_parallel(const char* code_in, size_t length_in, char* plaintext_out,
+                              const base64_alphabet* alphabet, int threads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASE64_CPARALLEL_H */
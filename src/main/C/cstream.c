@@ -0,0 +1,308 @@
+/*
+ * cstream.c - base64 encoding and decoding between file descriptors
+ *
+ * The input is taken in chunks of STREAM_CHUNK bytes, either read into a
+ * buffer or, for regular files, straight from a window of the file
+ * mapped into memory. Every chunk goes through the block coder into an
+ * output buffer sized for the worst case and is written out before the
+ * next one is taken, so memory use does not depend on the file size.
+ *
+ * Build with -DBASE64_STREAM_TOOL for a command line filter.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include "cstream.h"
+#include "cencode.h"
+
+#if defined(_WIN32)
+#include <io.h>
+typedef int io_result;
+#define sys_read(fd, buffer, size) _read(fd, buffer, (unsigned int) (size))
+#define sys_write(fd, buffer, size) _write(fd, buffer, (unsigned int) (size))
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+typedef ssize_t io_result;
+#define sys_read(fd, buffer, size) read(fd, buffer, size)
+#define sys_write(fd, buffer, size) write(fd, buffer, size)
+#define STREAM_MMAP 1
+#endif
+
+/* input per block call, a multiple of 3 and 4 */
+#define STREAM_CHUNK (192 * 1024)
+/* encoding: 4 characters per 3 bytes, plus at most one newline per group and the blockend */
+#define ENCODE_OUT (STREAM_CHUNK / 3 * 5 + 16)
+#define DECODE_OUT (STREAM_CHUNK / 4 * 3 + 4)
+/* mapped part of a regular file, a multiple of any page size */
+#define MAP_WINDOW (64 * 1024 * 1024)
+
+typedef struct
+{
+    int fd;
+    char* buffer;               /* read() fallback */
+#if defined(STREAM_MMAP)
+    char* map;                  /* current window, NULL when reading */
+    size_t map_length;
+    size_t used;                /* handed out from the window */
+    off_t map_offset;           /* file offset of the window */
+    off_t end;                  /* file size */
+#endif
+} stream_source;
+
+static void source_open(stream_source* src, int fd)
+{
+    src->fd = fd;
+    src->buffer = NULL;
+#if defined(STREAM_MMAP)
+    src->map = NULL;
+    {
+        struct stat st;
+        const off_t pos = lseek(fd, 0, SEEK_CUR);
+        const off_t page = (off_t) sysconf(_SC_PAGESIZE);
+
+        if (pos < 0 || page <= 0 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= pos)
+            return;
+        /* windows start on a page; the first one skips up to the current position */
+        src->map_offset = pos / page * page;
+        src->end = st.st_size;
+        src->map_length = (st.st_size - src->map_offset > MAP_WINDOW) ? MAP_WINDOW
+                        : (size_t) (st.st_size - src->map_offset);
+        src->map = mmap(NULL, src->map_length, PROT_READ, MAP_PRIVATE, fd, src->map_offset);
+        if (src->map == MAP_FAILED)
+        {
+            src->map = NULL;
+            return;
+        }
+        src->used = (size_t) (pos - src->map_offset);
+#if defined(POSIX_MADV_SEQUENTIAL)
+        posix_madvise(src->map, src->map_length, POSIX_MADV_SEQUENTIAL);
+#endif
+    }
+#endif
+}
+
+/*
+Next chunk of input: returns its size with '*data' pointing at it, 0 at
+the end, -1 if reading failed.
+*/
+static long source_next(stream_source* src, const char** data)
+{
+    io_result n;
+
+#if defined(STREAM_MMAP)
+    if (src->map != NULL)
+    {
+        size_t size;
+
+        if (src->used == src->map_length)
+        {
+            munmap(src->map, src->map_length);
+            src->map_offset += src->map_length;
+            src->map = NULL;
+            /* leave the descriptor where reading would have */
+            lseek(src->fd, src->map_offset, SEEK_SET);
+            if (src->map_offset >= src->end)
+                return 0;
+            src->map_length = (src->end - src->map_offset > MAP_WINDOW) ? MAP_WINDOW
+                            : (size_t) (src->end - src->map_offset);
+            src->map = mmap(NULL, src->map_length, PROT_READ, MAP_PRIVATE, src->fd, src->map_offset);
+            if (src->map == MAP_FAILED)
+            {
+                /* carry on reading from the start of the window */
+                src->map = NULL;
+                return source_next(src, data);
+            }
+            src->used = 0;
+#if defined(POSIX_MADV_SEQUENTIAL)
+            posix_madvise(src->map, src->map_length, POSIX_MADV_SEQUENTIAL);
+#endif
+        }
+        size = src->map_length - src->used;
+        if (size > STREAM_CHUNK)
+            size = STREAM_CHUNK;
+        *data = src->map + src->used;
+        src->used += size;
+        return (long) size;
+    }
+#endif
+    if (src->buffer == NULL && (src->buffer = malloc(STREAM_CHUNK)) == NULL)
+        return -1;
+    do {
+        n = sys_read(src->fd, src->buffer, STREAM_CHUNK);
+    } while (n < 0 && errno == EINTR);
+    *data = src->buffer;
+    return (long) n;
+}
+
+static void source_close(stream_source* src)
+{
+#if defined(STREAM_MMAP)
+    if (src->map != NULL)
+    {
+        munmap(src->map, src->map_length);
+        lseek(src->fd, src->map_offset + (off_t) src->used, SEEK_SET);
+    }
+#endif
+    free(src->buffer);
+}
+
+static int write_all(int fd, const char* data, size_t size)
+{
+    while (size > 0)
+    {
+        const io_result n = sys_write(fd, data, size);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        data += n;
+        size -= (size_t) n;
+    }
+    return 0;
+}
+
+int base64_encode_fd(int fd_in, int fd_out, int chars_per_line, const base64_alphabet* alphabet, int padding)
+{
+    base64_encodestate state;
+    stream_source src;
+    const char* data;
+    char* out;
+    long n;
+    int cnt, rc = 0;
+
+    if (base64_init_encodestate_wrap(&state, chars_per_line) != 0)
+    {
+        errno = EINVAL;
+        return BASE64_FD_IO_ERROR;
+    }
+    base64_encodestate_set_alphabet(&state, (alphabet != NULL) ? alphabet : &base64_alphabet_standard, padding);
+    if ((out = malloc(ENCODE_OUT)) == NULL)
+        return BASE64_FD_IO_ERROR;
+    source_open(&src, fd_in);
+
+    while ((n = source_next(&src, &data)) > 0)
+    {
+        cnt = base64_encode_block(data, (int) n, out, &state);
+        if (write_all(fd_out, out, cnt) != 0)
+        {
+            rc = BASE64_FD_IO_ERROR;
+            break;
+        }
+    }
+    if (rc == 0 && n < 0)
+        rc = BASE64_FD_IO_ERROR;
+    if (rc == 0)
+    {
+        /* the count includes the terminating '\0', which does not belong in a file */
+        cnt = base64_encode_blockend(out, &state) - 1;
+        if (write_all(fd_out, out, cnt) != 0)
+            rc = BASE64_FD_IO_ERROR;
+    }
+    source_close(&src);
+    free(out);
+    return rc;
+}
+
+int base64_decode_fd(int fd_in, int fd_out, const base64_alphabet* alphabet, base64_decodemode mode,
+                     size_t* error_offset)
+{
+    base64_decodestate state;
+    stream_source src;
+    const char* data;
+    char* out;
+    long n;
+    int cnt, rc = 0;
+
+    base64_init_decodestate(&state);
+    base64_decodestate_set_alphabet(&state, (alphabet != NULL) ? alphabet : &base64_alphabet_standard);
+    base64_decodestate_set_mode(&state, mode);
+    if ((out = malloc(DECODE_OUT)) == NULL)
+        return BASE64_FD_IO_ERROR;
+    source_open(&src, fd_in);
+
+    while ((n = source_next(&src, &data)) > 0)
+    {
+        cnt = base64_decode_block(data, (int) n, out, &state);
+        if (write_all(fd_out, out, cnt) != 0)
+        {
+            rc = BASE64_FD_IO_ERROR;
+            break;
+        }
+        if (state.step == step_error)
+            break;
+    }
+    if (rc == 0 && n < 0)
+        rc = BASE64_FD_IO_ERROR;
+    else if (rc == 0 && base64_decode_blockend(&state) != 0)
+    {
+        if (error_offset != NULL)
+            *error_offset = state.offset;
+        rc = BASE64_FD_BAD_INPUT;
+    }
+    source_close(&src);
+    free(out);
+    return rc;
+}
+
+#if defined(BASE64_STREAM_TOOL)
+
+#include <stdio.h>
+#include <string.h>
+
+static int usage(void)
+{
+    fputs("usage: b64 [-d [-t|-s]] [-w chars] [-u] [-n]\n"
+          "  -d  decode (default: encode)\n"
+          "  -t  decode: skip white space only\n"
+          "  -s  decode: skip nothing\n"
+          "  -w  encode: wrap lines at chars, a multiple of 4 (default 76, 0 for none)\n"
+          "  -u  URL and filename safe alphabet\n"
+          "  -n  encode: no padding\n", stderr);
+    return 2;
+}
+
+/* stdin to stdout */
+int main(int argc, char** argv)
+{
+    base64_decodemode mode = base64_lenient;
+    int decode = 0, padding = 1, chars_per_line = BASE64_WRAP_MIME;
+    const base64_alphabet* alphabet = &base64_alphabet_standard;
+    size_t error_offset = 0;
+    int i, rc;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-d") == 0) decode = 1;
+        else if (strcmp(argv[i], "-t") == 0) mode = base64_tolerant;
+        else if (strcmp(argv[i], "-s") == 0) mode = base64_strict;
+        else if (strcmp(argv[i], "-u") == 0) alphabet = &base64_alphabet_url;
+        else if (strcmp(argv[i], "-n") == 0) padding = 0;
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc) chars_per_line = atoi(argv[++i]);
+        else return usage();
+    }
+
+    if (decode)
+        rc = base64_decode_fd(0, 1, alphabet, mode, &error_offset);
+    else
+        rc = base64_encode_fd(0, 1, chars_per_line, alphabet, padding);
+    if (rc == BASE64_FD_BAD_INPUT)
+    {
+        fprintf(stderr, "b64: invalid input at offset %lu\n", (unsigned long) error_offset);
+        return 1;
+    }
+    if (rc != 0)
+    {
+        perror("b64");
+        return 1;
+    }
+    return 0;
+}
+
+#endif /* BASE64_STREAM_TOOL */
@@ -0,0 +1,47 @@
+/*
+ * cstream.h - base64 encoding and decoding between file descriptors
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#ifndef BASE64_CSTREAM_H
+#define BASE64_CSTREAM_H
+
+#include <stddef.h>
+
+#include "calphabet.h"
+#include "cdecode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* return codes of the fd functions besides 0 */
+#define BASE64_FD_IO_ERROR -1       /* read or write failed, see errno */
+#define BASE64_FD_BAD_INPUT -2      /* malformed input (tolerant and strict decoding) */
+
+/*
+Encode everything readable from fd_in to fd_out, in constant memory.
+Lines are wrapped at chars_per_line as by base64_init_encodestate_wrap,
+and the output ends with the last character (no newline, no '\0'). A
+NULL alphabet selects the standard one. Regular files are mapped rather
+than read where the system allows it. Returns 0 or BASE64_FD_IO_ERROR,
+the latter with errno EINVAL for an invalid chars_per_line.
+*/
+int base64_encode_fd(int fd_in, int fd_out, int chars_per_line, const base64_alphabet* alphabet, int padding);
+
+/*
+Decode everything readable from fd_in to fd_out, in constant memory, in
+the given mode (see base64_decodestate_set_mode). Returns 0,
+BASE64_FD_IO_ERROR, or BASE64_FD_BAD_INPUT with *error_offset (if not
+NULL) set to the offset of the offending character in the input. What
+decoded before that point has been written by then.
+*/
+int base64_decode_fd(int fd_in, int fd_out, const base64_alphabet* alphabet, base64_decodemode mode,
+                     size_t* error_offset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BASE64_CSTREAM_H */
@@ -57,19 +57,22 @@
 
 
 #include "encoding.h"
+#include "simd.h"
+#include "codepages.h" /* generated by gencodepages.py */
 
 #include <string.h>
 #include <stdlib.h> /* malloc */
-
+#if defined(_MSC_VER) && defined(SIMD_SSE2)
+#include <intrin.h> /* _BitScanForward */
+#endif
 
 
 #if defined (_WIN64) || defined (_WIN32) && (!defined(__MINGW32__) && !defined(__MINGW64__))
-/* disable "'xmltranscodetable_ISO8859_15' : array is too small to include a terminating null character" */
+/* disable "'xmltranscodetable_ISO8859_2' : array is too small to include a terminating null character" */
 #pragma warning( disable: 4295 )
 #endif /* (_WIN64) || (_WIN32) */
 
 
-
 /************************************************************************
  *                                                                      *
  *      Conversions To/From UTF8 encoding                               *
@@ -77,6 +80,402 @@
  ************************************************************************/
 
 
+#if defined(SIMD_SSE2)
+/* index of the lowest set bit of a non-zero mask */
+static int
+lowestBit(unsigned int mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int) index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif /* SIMD_SSE2 */
+
+
+/**
+ * copyAscii:
+ * @out:  where to copy to
+ * @in:  where to copy from
+ * @len:  room in both @in and @out
+ *
+ * Copy the run of US-ASCII bytes at the start of @in to @out, 16 or 32
+ * bytes at a time, stopping at the first byte >= 0x80 or less than a
+ * vector before @len. The conversion loops only need their byte by byte
+ * decoding around non-ASCII characters.
+ * Returns the number of bytes copied.
+ */
+static int
+copyAscii(unsigned char* out, const unsigned char* in, int len) {
+
+    int n = 0;
+
+#if defined(SIMD_AVX2)
+    while (len - n >= 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (in + n));
+        unsigned int high = (unsigned int) _mm256_movemask_epi8(v);
+        _mm256_storeu_si256((__m256i*) (out + n), v);
+        if (high != 0) {
+            return n + lowestBit(high);
+        }
+        n += 32;
+    }
+#endif
+#if defined(SIMD_SSE2)
+    while (len - n >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (in + n));
+        unsigned int high = (unsigned int) _mm_movemask_epi8(v);
+        _mm_storeu_si128((__m128i*) (out + n), v);
+        if (high != 0) {
+            return n + lowestBit(high);
+        }
+        n += 16;
+    }
+#else
+    (void) out;
+    (void) in;
+    (void) len;
+#endif
+    return n;
+}
+
+
+/************************************************************************
+ *                                                                      *
+ *      UTF-8 validation                                                *
+ *                                                                      *
+ ************************************************************************/
+
+
+/**
+ * scanUtf8:
+ * @in:  a pointer to an array of bytes
+ * @len:  the length of @in
+ * @valid:  set to the length of the well-formed prefix of @in
+ *
+ * Check @in one character at a time against the well-formed byte
+ * sequences of the Unicode Standard, table 3-7: no overlong forms, no
+ * surrogates, nothing above U+10FFFF.
+ * Returns 0 if all of @in is well-formed, -2 if only its last character
+ * is incomplete, or -1 otherwise.
+ */
+static int
+scanUtf8(const unsigned char* in, size_t len, size_t* valid) {
+
+    size_t i = 0;
+
+    while (i < len) {
+        unsigned int c = in[i];
+        unsigned int lo = 0x80;
+        unsigned int hi = 0xBF;
+        size_t trailing;
+        size_t k;
+
+        if (c < 0x80) {
+            ++i;
+            continue;
+        }
+        if (c < 0xC2) {
+            /* trailing byte in leading position, or overlong 2 byte form */
+            *valid = i;
+            return -1;
+        } else if (c < 0xE0) {
+            trailing = 1;
+        } else if (c < 0xF0) {
+            trailing = 2;
+            if (c == 0xE0) {
+                lo = 0xA0;
+            } else if (c == 0xED) {
+                hi = 0x9F;
+            }
+        } else if (c < 0xF5) {
+            trailing = 3;
+            if (c == 0xF0) {
+                lo = 0x90;
+            } else if (c == 0xF4) {
+                hi = 0x8F;
+            }
+        } else {
+            *valid = i;
+            return -1;
+        }
+        for (k = 1; k <= trailing; k++) {
+            if (i + k == len) {
+                *valid = i;
+                return -2;
+            }
+            if (in[i + k] < lo || in[i + k] > hi) {
+                *valid = i;
+                return -1;
+            }
+            lo = 0x80;
+            hi = 0xBF;
+        }
+        i += trailing + 1;
+    }
+    *valid = len;
+    return 0;
+}
+
+
+#if defined(SIMD_SSSE3)
+/*
+ * The vector check is the lookup algorithm of Keiser and Lemire,
+ * "Validating UTF-8 In Less Than One Instruction Per Byte" (2021): every
+ * ill-formed pair of adjacent bytes sets at least one of these bits in
+ * all three of the tables below, looked up by the high and low nibble of
+ * the first byte and the high nibble of the second. What a pair cannot
+ * show (a third or fourth byte missing or in excess) is found by looking
+ * two and three bytes back.
+ */
+#define UTF8_TOO_SHORT      0x01    /* lead byte not followed by a trailing byte */
+#define UTF8_TOO_LONG       0x02    /* trailing byte after US-ASCII */
+#define UTF8_OVERLONG_3     0x04    /* E0 80..9F */
+#define UTF8_TOO_LARGE      0x08    /* F4 90..BF, F5..FF */
+#define UTF8_SURROGATE      0x10    /* ED A0..BF */
+#define UTF8_OVERLONG_2     0x20    /* C0, C1 */
+#define UTF8_TOO_LARGE_1000 0x40    /* F5..FF 80..8F */
+#define UTF8_OVERLONG_4     0x40    /* F0 80..8F */
+#define UTF8_TWO_CONTS      0x80    /* trailing byte after trailing byte, right unless 3 or 4 bytes long */
+#define UTF8_CARRY          (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+/* first byte, high nibble */
+static const unsigned char utf8Byte1High[16] = {
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+};
+
+/* first byte, low nibble */
+static const unsigned char utf8Byte1Low[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    UTF8_CARRY,
+    UTF8_CARRY,
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+};
+
+/* second byte, high nibble */
+static const unsigned char utf8Byte2High[16] = {
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+};
+
+/* a byte above this in the last three of a block starts a character the block does not finish */
+static const unsigned char utf8Incomplete[16] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+};
+
+
+#if !defined(SIMD_AVX2)
+/* non-zero bytes where the 16 bytes of input, after the 16 of prev, are ill-formed */
+static __m128i
+utf8Errors128(__m128i input, __m128i prev) {
+
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+    __m128i special;
+    __m128i must23;
+
+    special = _mm_and_si128(
+        _mm_and_si128(
+            _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) utf8Byte1High),
+                             _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+            _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) utf8Byte1Low),
+                             _mm_and_si128(prev1, nibble))),
+        _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) utf8Byte2High),
+                         _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+    /* third and fourth bytes must be where E0..EF and F0..F4 lead two and three bytes back */
+    must23 = _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8((char) (0xE0 - 0x80))),
+                          _mm_subs_epu8(prev3, _mm_set1_epi8((char) (0xF0 - 0x80))));
+    return _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8((char) 0x80)), special);
+}
+#endif /* !SIMD_AVX2 */
+#endif /* SIMD_SSSE3 */
+
+
+#if defined(SIMD_AVX2)
+/* non-zero bytes where the 32 bytes of input, after the 32 of prev, are ill-formed */
+static __m256i
+utf8Errors256(__m256i input, __m256i prev) {
+
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i before = _mm256_permute2x128_si256(prev, input, 0x21);
+    const __m256i prev1 = _mm256_alignr_epi8(input, before, 15);
+    const __m256i prev2 = _mm256_alignr_epi8(input, before, 14);
+    const __m256i prev3 = _mm256_alignr_epi8(input, before, 13);
+    __m256i special;
+    __m256i must23;
+
+    special = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) utf8Byte1High)),
+                                _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+            _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) utf8Byte1Low)),
+                                _mm256_and_si256(prev1, nibble))),
+        _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) utf8Byte2High)),
+                            _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+    must23 = _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8((char) (0xE0 - 0x80))),
+                             _mm256_subs_epu8(prev3, _mm256_set1_epi8((char) (0xF0 - 0x80))));
+    return _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8((char) 0x80)), special);
+}
+#endif /* SIMD_AVX2 */
+
+
+/**
+ * checkUtf8:
+ * @in:  a pointer to an array of bytes
+ * @len:  the length of @in
+ * @valid:  set to the length of the well-formed prefix of @in
+ *
+ * scanUtf8(), 16 or 32 bytes at a time. The vector loop runs until a
+ * block is found wanting; scanUtf8() then takes over at the start of the
+ * character that may straddle the last good block, and pins down the
+ * offending character (or checks the rest that does not fill a block).
+ * Returns 0 if all of @in is well-formed, -2 if only its last character
+ * is incomplete, or -1 otherwise.
+ */
+static int
+checkUtf8(const unsigned char* in, size_t len, size_t* valid) {
+
+    size_t pos = 0;
+    size_t k;
+    int rc;
+
+#if defined(SIMD_AVX2)
+    if (len >= 32) {
+        const __m256i incomplete = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) utf8Incomplete));
+        __m256i prev = _mm256_setzero_si256();
+        while (len - pos >= 32) {
+            __m256i input = _mm256_loadu_si256((const __m256i*) (in + pos));
+            __m256i errors;
+            if (_mm256_movemask_epi8(input) == 0) {
+                /* US-ASCII is fine unless the block before left a character unfinished */
+                errors = _mm256_subs_epu8(prev, incomplete);
+                errors = _mm256_permute2x128_si256(errors, errors, 0x11);
+            } else {
+                errors = utf8Errors256(input, prev);
+            }
+            if (!_mm256_testz_si256(errors, errors)) {
+                break;
+            }
+            prev = input;
+            pos += 32;
+        }
+    }
+#elif defined(SIMD_SSSE3)
+    if (len >= 16) {
+        const __m128i incomplete = _mm_loadu_si128((const __m128i*) utf8Incomplete);
+        __m128i prev = _mm_setzero_si128();
+        while (len - pos >= 16) {
+            __m128i input = _mm_loadu_si128((const __m128i*) (in + pos));
+            __m128i errors;
+            if (_mm_movemask_epi8(input) == 0) {
+                errors = _mm_subs_epu8(prev, incomplete);
+            } else {
+                errors = utf8Errors128(input, prev);
+            }
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(errors, _mm_setzero_si128())) != 0xFFFF) {
+                break;
+            }
+            prev = input;
+            pos += 16;
+        }
+    }
+#endif
+    /* back to the lead byte of a character the good blocks may have cut */
+    for (k = 1; k <= 3 && k <= pos; k++) {
+        if (in[pos - k] >= 0xC0) {
+            pos -= k;
+            break;
+        }
+        if (in[pos - k] < 0x80) {
+            break;
+        }
+    }
+    rc = scanUtf8(in + pos, len - pos, valid);
+    *valid += pos;
+    return rc;
+}
+
+
+/**
+ * utf8Validate:
+ * @in:  a pointer to an array of bytes
+ * @len:  the length of @in
+ * @errorOffset:  set to the offset of the first ill-formed sequence, may be NULL
+ *
+ * Check that @in is well-formed UTF-8.
+ * Returns 0 if it is, or -1 otherwise.
+ */
+int utf8Validate(const unsigned char* in, size_t len, size_t* errorOffset) {
+
+    size_t valid = 0;
+
+    if (len == 0 || (in != NULL && checkUtf8(in, len, &valid) == 0)) {
+        return 0;
+    }
+    if (errorOffset != NULL) {
+        *errorOffset = valid;
+    }
+    return -1;
+}
+
+
+/**
+ * validUtf8:
+ * @in:  a pointer to an array of UTF-8 chars
+ * @inlen:  the length of @in
+ * @outlen:  the room for single byte characters converted from @in
+ * @malformed:  set to 1 if @in has an ill-formed character after the prefix, 0 otherwise
+ *
+ * Validation for the conversion functions, which decode the prefix this
+ * returns without checking it again. Only as much of @in is looked at as
+ * @outlen could hold, so a caller converting a large input through a
+ * small output buffer does not have the whole input validated each time.
+ * Returns the length of the well-formed prefix of @in, without a final
+ * character that is incomplete or that the look-ahead cut.
+ */
+static int
+validUtf8(const unsigned char* in, int inlen, int outlen, int* malformed) {
+
+    size_t len = (size_t) inlen;
+    size_t valid;
+
+    /* outlen characters of 4 bytes at most, one more maybe cut */
+    if (len / 4 > (size_t) outlen + 1) {
+        len = ((size_t) outlen + 1) * 4;
+    }
+    *malformed = (checkUtf8(in, len, &valid) == -1);
+    return (int) valid;
+}
+
+
 /**
  * UTF8Toisolat1:
  * @out:  a pointer to an array of bytes to store the result
@@ -100,8 +499,9 @@ int UTF8Toisolat1(unsigned char* out, int *outlen,
     const unsigned char* outstart = out;
     const unsigned char* instart = in;
     const unsigned char* inend;
-    unsigned int c, d;
+    unsigned int c;
     int trailing;
+    int malformed;
 
     if (in == NULL) {
         /*
@@ -112,62 +512,43 @@ int UTF8Toisolat1(unsigned char* out, int *outlen,
         return 0;
     }
 
-    inend = in + (*inlen);
+    /* the well-formed prefix, decoded below without further checks */
+    inend = in + validUtf8(in, *inlen, *outlen, &malformed);
     outend = out + (*outlen);
     while (in < inend) {
-        d = *in++;
-        if (d < 0x80) {
-            c = d;
+        int ascii = copyAscii(out, in, (inend - in < outend - out) ? inend - in : outend - out);
+        if (ascii > 0) {
+            in += ascii;
+            out += ascii;
+            processed = in;
+            continue;
+        }
+        c = *in++;
+        if (c < 0x80) {
             trailing = 0;
-        } else if (d < 0xC0) {
-            /* trailing byte in leading position */
-            *outlen = out - outstart;
-            *inlen = processed - instart;
-            return -2;
-        } else if (d < 0xE0) {
-            c = d & 0x1F;
+        } else if (c < 0xE0) {
+            c &= 0x1F;
             trailing = 1;
-        } else if (d < 0xF0) {
-            c = d & 0x0F;
+        } else if (c < 0xF0) {
+            c &= 0x0F;
             trailing = 2;
-        } else if (d < 0xF8) {
-            c = d & 0x07;
-            trailing = 3;
         } else {
-            /* no chance for this in IsoLatin-1 */
-            *outlen = out - outstart;
-            *inlen = processed - instart;
-            return -2;
-        }
-
-        if (inend - in < trailing) {
-            break;
+            c &= 0x07;
+            trailing = 3;
         }
-
         for ( ; trailing; trailing--) {
-            if (in >= inend) {
-                break;
-            }
-            if (((d = *in++) & 0xC0) != 0x80) {
-                *outlen = out - outstart;
-                *inlen = processed - instart;
-                return -2;
-            }
             c <<= 6;
-            c |= d & 0x3F;
+            c |= *in++ & 0x3F;
+        }
+        if (out >= outend) {
+            break;
         }
 
         /* assertion: c is a single UTF-4 value */
         if (c <= 0xFF) {
-            if (out >= outend) {
-                break;
-            }
             *out++ = (unsigned char) c;
         } else {
             /* no chance for this in IsoLatin-1 */
-            if (out >= outend) {
-                break;
-            }
 
             /*
              * substitute some well-known Windows-1252 codes (for those
@@ -220,8 +601,215 @@ int UTF8Toisolat1(unsigned char* out, int *outlen,
     } /* while */
     *outlen = out - outstart;
     *inlen = processed - instart;
-    return 0;
+    /* stopped at an ill-formed character rather than by a full buffer */
+    return (malformed && processed == inend) ? -2 : 0;
+}
+
+
+#if defined(SIMD_SSE2)
+/* number of set bits */
+static int
+countBits(unsigned int mask) {
+#if defined(__GNUC__) && defined(__POPCNT__)
+    return __builtin_popcount(mask);
+#else
+    mask = mask - ((mask >> 1) & 0x55555555);
+    mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+    return (int) ((((mask + (mask >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+#endif
+}
+
+
+/*
+ * Latin-1 bytes widened to 16 bits become their UTF-8 form in place: a
+ * byte >= 0x80 turns into the two bytes C2/C3 and 0x80 | (c & 0x3F), a
+ * US-ASCII byte keeps a zero high byte, which has to go. Packing the
+ * rest together is a left shift of every byte by the number of US-ASCII
+ * words before it, a prefix sum done with three byte shifts; the shift
+ * itself is done one bit of the amount at a time, which never lets two
+ * bytes collide. Without pshufb or a table this needs nothing beyond
+ * SSE2.
+ */
+#if !defined(SIMD_AVX2)
+/* move the bytes whose amount has bit k set k places down, amounts with them */
+#define EXPAND_STEP128(words, amount, k) do { \
+        const __m128i bit = _mm_set1_epi8(k); \
+        const __m128i move = _mm_cmpeq_epi8(_mm_and_si128(amount, bit), bit); \
+        words = _mm_or_si128(_mm_andnot_si128(move, words), _mm_srli_si128(_mm_and_si128(move, words), k)); \
+        amount = _mm_or_si128(_mm_andnot_si128(move, amount), _mm_srli_si128(_mm_and_si128(move, amount), k)); \
+    } while (0)
+
+static __m128i
+expand128(__m128i words) {
+
+    const __m128i high = _mm_cmpgt_epi16(words, _mm_set1_epi16(0x7F));
+    const __m128i ascii = _mm_andnot_si128(high, _mm_set1_epi16(0x0101));
+    __m128i amount;
+    __m128i two;
+
+    two = _mm_or_si128(_mm_or_si128(_mm_srli_epi16(words, 6), _mm_set1_epi16(0xC0)),
+                       _mm_slli_epi16(_mm_or_si128(_mm_and_si128(words, _mm_set1_epi16(0x3F)),
+                                                   _mm_set1_epi16(0x80)), 8));
+    words = _mm_or_si128(_mm_andnot_si128(high, words), _mm_and_si128(high, two));
+
+    amount = _mm_add_epi8(ascii, _mm_slli_si128(ascii, 2));
+    amount = _mm_add_epi8(amount, _mm_slli_si128(amount, 4));
+    amount = _mm_add_epi8(amount, _mm_slli_si128(amount, 8));
+    amount = _mm_sub_epi8(amount, ascii);
+    /* the zero bytes to drop stay where they are */
+    amount = _mm_andnot_si128(_mm_andnot_si128(high, _mm_set1_epi16((short) 0xFF00)), amount);
+
+    EXPAND_STEP128(words, amount, 1);
+    EXPAND_STEP128(words, amount, 2);
+    EXPAND_STEP128(words, amount, 4);
+    return words;
+}
+#endif /* !SIMD_AVX2 */
+#endif /* SIMD_SSE2 */
+
+
+#if defined(SIMD_AVX2)
+/*
+ * With pshufb the packing takes a table instead: four words, 4 to 8
+ * bytes of UTF-8, are packed by the entry for their 4 high bits, and
+ * stored where the prefix sum of the bits before them puts them.
+ */
+static const unsigned char packWords[16][8] = {
+    { 0, 2, 4, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 6, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 4, 6, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 6, 0x80, 0x80 },
+    { 0, 2, 4, 5, 6, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 5, 6, 0x80, 0x80 },
+    { 0, 2, 3, 4, 5, 6, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 5, 6, 0x80 },
+    { 0, 2, 4, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 6, 7, 0x80, 0x80 },
+    { 0, 2, 3, 4, 6, 7, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 6, 7, 0x80 },
+    { 0, 2, 4, 5, 6, 7, 0x80, 0x80 },
+    { 0, 1, 2, 4, 5, 6, 7, 0x80 },
+    { 0, 2, 3, 4, 5, 6, 7, 0x80 },
+    { 0, 1, 2, 3, 4, 5, 6, 7 }
+};
+
+/* the 16 Latin-1 bytes in @bytes, with @high their high bits, as UTF-8 at @out; returns its length */
+static int
+expand256(unsigned char* out, __m128i bytes, unsigned int high) {
+
+    __m256i words = _mm256_cvtepu8_epi16(bytes);
+    const __m256i nonAscii = _mm256_cmpgt_epi16(words, _mm256_set1_epi16(0x7F));
+    __m256i two;
+    __m256i shuffle;
+    __m128i lo;
+    __m128i hi;
+    int at;
+
+    two = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi16(words, 6), _mm256_set1_epi16(0xC0)),
+                          _mm256_slli_epi16(_mm256_or_si256(_mm256_and_si256(words, _mm256_set1_epi16(0x3F)),
+                                                            _mm256_set1_epi16(0x80)), 8));
+    words = _mm256_blendv_epi8(words, two, nonAscii);
+
+    /* the second four words of a lane start at byte 8 */
+    lo = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*) packWords[high & 15]),
+                            _mm_loadl_epi64((const __m128i*) packWords[(high >> 4) & 15]));
+    hi = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*) packWords[(high >> 8) & 15]),
+                            _mm_loadl_epi64((const __m128i*) packWords[high >> 12]));
+    shuffle = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    shuffle = _mm256_add_epi8(shuffle, _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8,
+                                                        0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8));
+    words = _mm256_shuffle_epi8(words, shuffle);
+
+    lo = _mm256_castsi256_si128(words);
+    hi = _mm256_extracti128_si256(words, 1);
+    _mm_storel_epi64((__m128i*) out, lo);
+    at = 4 + countBits(high & 15);
+    _mm_storel_epi64((__m128i*) (out + at), _mm_unpackhi_epi64(lo, lo));
+    at += 4 + countBits((high >> 4) & 15);
+    _mm_storel_epi64((__m128i*) (out + at), hi);
+    at += 4 + countBits((high >> 8) & 15);
+    _mm_storel_epi64((__m128i*) (out + at), _mm_unpackhi_epi64(hi, hi));
+    return at + 4 + countBits(high >> 12);
+}
+#endif /* SIMD_AVX2 */
+
+
+#if defined(SIMD_SSE2)
+/**
+ * expandLatin1:
+ * @out:  where to store the UTF-8
+ * @produced:  set to the number of bytes stored
+ * @in:  the Latin-1 input
+ * @len:  the length of @in
+ * @room:  the room in @out
+ *
+ * Convert Latin-1 to UTF-8 32 or 16 bytes at a time, for as long as
+ * there are that many and twice the room for them. AVX-512 VBMI2 does
+ * the packing of expand128() in one vpcompressb.
+ * Returns the number of bytes of @in converted.
+ */
+static int
+expandLatin1(unsigned char* out, int* produced, const unsigned char* in, int len, int room) {
+
+    int n = 0;
+    int m = 0;
+
+#if defined(SIMD_AVX512VBMI2)
+    while (len - n >= 32 && room - m >= 64) {
+        const __m256i bytes = _mm256_loadu_si256((const __m256i*) (in + n));
+        const unsigned int high = (unsigned int) _mm256_movemask_epi8(bytes);
+        __m512i words;
+        __m512i two;
+
+        if (high == 0) {
+            _mm256_storeu_si256((__m256i*) (out + m), bytes);
+            n += 32;
+            m += 32;
+            continue;
+        }
+        words = _mm512_cvtepu8_epi16(bytes);
+        two = _mm512_or_si512(_mm512_or_si512(_mm512_srli_epi16(words, 6), _mm512_set1_epi16(0xC0)),
+                              _mm512_slli_epi16(_mm512_or_si512(_mm512_and_si512(words, _mm512_set1_epi16(0x3F)),
+                                                                _mm512_set1_epi16(0x80)), 8));
+        words = _mm512_mask_mov_epi16(words, (__mmask32) high, two);
+        /* the low byte of every word, the high byte of the non-ASCII ones */
+        _mm512_storeu_si512((void*) (out + m), _mm512_maskz_compress_epi8(
+            (__mmask64) (0x5555555555555555ULL | _pdep_u64(high, 0xAAAAAAAAAAAAAAAAULL)), words));
+        n += 32;
+        m += 32 + countBits(high);
+    }
+#endif
+#if defined(SIMD_AVX2)
+    while (len - n >= 16 && room - m >= 32) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*) (in + n));
+        const unsigned int high = (unsigned int) _mm_movemask_epi8(bytes);
+        n += 16;
+        if (high == 0) {
+            _mm_storeu_si128((__m128i*) (out + m), bytes);
+            m += 16;
+        } else {
+            m += expand256(out + m, bytes, high);
+        }
+    }
+#else
+    while (len - n >= 16 && room - m >= 32) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*) (in + n));
+        const unsigned int high = (unsigned int) _mm_movemask_epi8(bytes);
+        if (high == 0) {
+            _mm_storeu_si128((__m128i*) (out + m), bytes);
+        } else {
+            _mm_storeu_si128((__m128i*) (out + m), expand128(_mm_unpacklo_epi8(bytes, _mm_setzero_si128())));
+            _mm_storeu_si128((__m128i*) (out + m + 8 + countBits(high & 0xFF)),
+                             expand128(_mm_unpackhi_epi8(bytes, _mm_setzero_si128())));
+        }
+        n += 16;
+        m += 16 + countBits(high);
+    }
+#endif
+    *produced = m;
+    return n;
 }
+#endif /* SIMD_SSE2 */
 
 
 /**
@@ -251,6 +839,15 @@ int isolat1ToUTF8(unsigned char* out, int *outlen,
     instop = inend;
 
     while (in < inend && out < outend - 1) {
+#if defined(SIMD_SSE2)
+        int produced;
+        int consumed = expandLatin1(out, &produced, in, inend - in, outend - out);
+        if (consumed > 0) {
+            in += consumed;
+            out += produced;
+            continue;
+        }
+#endif
         if (*in >= 0x80) {
             *out++ = (((*in) >>  6) & 0x1F) | 0xC0;
             *out++ = ((*in) & 0x3F) | 0x80;
@@ -259,6 +856,11 @@ int isolat1ToUTF8(unsigned char* out, int *outlen,
         if (instop - in > outend - out) {
             instop = in + (outend - out);
         }
+        {
+            int ascii = copyAscii(out, in, instop - in);
+            in += ascii;
+            out += ascii;
+        }
         while (in < instop && *in < 0x80) {
             *out++ = *in++;
         }
@@ -272,31 +874,50 @@ int isolat1ToUTF8(unsigned char* out, int *outlen,
 }
 
 
+/************************************************************************
+ *                                                                      *
+ *      Table-driven single byte codepages                              *
+ *                                                                      *
+ ************************************************************************/
+
+
 /**
- * UTF8ToISO8859x:
+ * UTF8ToSingleByteBlock:
  * @out:  a pointer to an array of bytes to store the result
  * @outlen:  the length of @out
  * @in:  a pointer to an array of UTF-8 chars
  * @inlen:  the length of @in
- * @xlattable: the 2-level transcoding table
+ * @codepage:  the codepage to convert to
+ * @partial:  whether a character that @in ends within is left for the next block
  *
- * Take a block of UTF-8 chars in and try to convert it to an ISO 8859-*
- * block of chars out.
+ * Take a block of UTF-8 chars in and try to convert it to a block of
+ * chars in a single byte codepage out. Runs of US-ASCII are copied a
+ * vector at a time; every other character is looked up in the two-level
+ * table of @codepage: by the lead byte for a block that the trailing
+ * byte indexes, with one more level for 3 byte sequences. A character
+ * not in the codepage fails the transcoding, or is replaced by
+ * @codepage->substitute if that is set.
  *
  * Returns 0 if success, -2 if the transcoding fails, or -1 otherwise
  * The value of @inlen after return is the number of octets consumed
  *     as the return value is positive, else unpredictable.
- * The value of @outlen after return is the number of octets consumed.
+ * The value of @outlen after return is the number of octets produced.
  */
 static int
-UTF8ToISO8859x(unsigned char* out, int *outlen,
-              const unsigned char* in, int *inlen,
-              unsigned char const *xlattable) {
+UTF8ToSingleByteBlock(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const encodingCodepage* codepage, int partial) {
 
+    unsigned char const* xlattable;
     const unsigned char* outstart = out;
-    const unsigned char* inend;
+    const unsigned char* outend;
     const unsigned char* instart = in;
+    const unsigned char* inend;
+    int malformed;
+    int length;
 
+    if (outlen == NULL || inlen == NULL || codepage == NULL) {
+        return -1;
+    }
     if (in == NULL) {
         /*
          * initialization, nothing to do
@@ -305,378 +926,663 @@ UTF8ToISO8859x(unsigned char* out, int *outlen,
         *inlen = 0;
         return 0;
     }
-    inend = in + (*inlen);
-    while (in < inend) {
-        unsigned char d = *in++;
-        if  (d < 0x80)  {
-            *out++ = d;
-        } else if (d < 0xC0) {
-            /* trailing byte in leading position */
-            *outlen = out - outstart;
-            *inlen = in - instart - 1;
-            return -2;
-        } else if (d < 0xE0) {
-            /* start of 2 byte sequence */
-            unsigned char c;
-            if (!(in < inend)) {
-                /* trailing byte not in input buffer */
-                *outlen = out - outstart;
-                *inlen = in - instart - 1;
-                return -2;
-            }
-            c = *in++;
-            if ((c & 0xC0) != 0x80) {
-                /* not a trailing byte */
-                *outlen = out - outstart;
-                *inlen = in - instart - 2;
-                return -2;
-            }
-            c = c & 0x3F;
-            d = d & 0x1F;
-            d = xlattable [48 + c + xlattable [d] * 64];
-            if (d == 0) {
-                /* not in character set */
-                *outlen = out - outstart;
-                *inlen = in - instart - 2;
-                return -2;
+    xlattable = codepage->fromUnicode;
+    /* the well-formed prefix, decoded below without further checks */
+    inend = in + validUtf8(in, *inlen, *outlen, &malformed);
+    outend = out + *outlen;
+    while (in < inend && out < outend) {
+        unsigned char d = *in;
+        if (d < 0x80) {
+            int ascii = copyAscii(out, in, (inend - in < outend - out) ? inend - in : outend - out);
+            if (ascii == 0) {
+                /* less than a vector left */
+                *out = d;
+                ascii = 1;
             }
-            *out++ = d;
+            in += ascii;
+            out += ascii;
+            continue;
+        }
+        if (d < 0xE0) {
+            /* 2 byte sequence */
+            d = xlattable [48 + (in[1] & 0x3F) + xlattable [d & 0x1F] * 64];
+            length = 2;
         } else if (d < 0xF0) {
-            /* start of 3 byte sequence */
-            unsigned char c1;
-            unsigned char c2;
-            if (!(in < inend - 1)) {
-                /* trailing bytes not in input buffer */
-                *outlen = out - outstart;
-                *inlen = in - instart - 1;
-                return -2;
-            }
-            c1 = *in++;
-            if ((c1 & 0xC0) != 0x80) {
-                /* not a trailing byte (c1) */
-                *outlen = out - outstart;
-                *inlen = in - instart - 2;
-                return -2;
-            }
-            c2 = *in++;
-            if ((c2 & 0xC0) != 0x80) {
-                /* not a trailing byte (c2) */
-                *outlen = out - outstart;
-                *inlen = in - instart - 2;
-                return -2;
-            }
-            c1 = c1 & 0x3F;
-            c2 = c2 & 0x3F;
-            d = d & 0x0F;
-            d = xlattable [48 + c2 + xlattable [48 + c1 + xlattable [32 + d] * 64] * 64];
+            /* 3 byte sequence */
+            d = xlattable [48 + (in[2] & 0x3F) +
+                           xlattable [48 + (in[1] & 0x3F) + xlattable [32 + (d & 0x0F)] * 64] * 64];
+            length = 3;
+        } else {
+            /* >= U+010000, in no single byte codepage */
+            d = 0;
+            length = 4;
+        }
+        if (d == 0) {
+            /* not in character set */
+            d = codepage->substitute;
             if (d == 0) {
-                /* not in character set */
-                *outlen = out - outstart;
-                *inlen = in - instart - 3;
-                return -2;
+                break;
             }
-            *out++ = d;
-        } else {
-            /* cannot transcode >= U+010000 */
-            *outlen = out - outstart;
-            *inlen = in - instart - 1;
-            return -2;
         }
+        in += length;
+        *out++ = d;
     }
     *outlen = out - outstart;
-    *inlen = in - instart;
+    if (in < inend) {
+        *inlen = in - instart;
+        /* stopped by a full buffer, or at a character not in the set */
+        return (out < outend) ? -2 : 0;
+    }
+    if (inend < instart + *inlen) {
+        /*
+         * an ill-formed or, at the end of the input, incomplete character:
+         * a prefix cut short by the look-ahead would have filled @out;
+         * with @partial the latter is left for the next block
+         */
+        *inlen = in - instart;
+        return (partial && !malformed) ? 0 : -2;
+    }
     return 0;
 }
 
 
 /**
- * ISO8859xToUTF8
+ * UTF8ToSingleByte:
  * @out:  a pointer to an array of bytes to store the result
  * @outlen:  the length of @out
- * @in:  a pointer to an array of ISO Latin 1 chars
+ * @in:  a pointer to an array of UTF-8 chars
  * @inlen:  the length of @in
+ * @codepage:  the codepage to convert to
  *
- * Take a block of ISO 8859-* chars in and try to convert it to an UTF-8
- * block of chars out.
- * Returns 0 if success, or -1 otherwise
+ * Take a block of UTF-8 chars in and try to convert it to a block of
+ * chars in a single byte codepage out. As with UTF8Toisolat1(), a
+ * character that @in ends within is not consumed and left for the next
+ * block.
+ *
+ * Returns 0 if success, -2 if the transcoding fails, or -1 otherwise
  * The value of @inlen after return is the number of octets consumed
+ *     as the return value is positive, else unpredictable.
  * The value of @outlen after return is the number of octets produced.
  */
-static int
-ISO8859xToUTF8(unsigned char* out, int *outlen,
-              const unsigned char* in, int *inlen,
-              unsigned short const *unicodetable) {
+int UTF8ToSingleByte(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const encodingCodepage* codepage) {
+
+    return UTF8ToSingleByteBlock(out, outlen, in, inlen, codepage, 1);
+}
+
+
+/**
+ * singleByteToUTF8:
+ * @out:  a pointer to an array of bytes to store the result
+ * @outlen:  the length of @out
+ * @in:  a pointer to an array of chars in @codepage
+ * @inlen:  the length of @in
+ * @codepage:  the codepage of @in
+ *
+ * Take a block of chars in a single byte codepage and try to convert it
+ * to an UTF-8 block of chars out. Runs of US-ASCII are copied a vector
+ * at a time; every other byte has its UTF-8 sequence stored with the
+ * length in 4 bytes of @codepage->toUtf8, which are copied as they are
+ * wherever there is room for them.
+ * Returns 0 if success, -2 if @in holds a byte undefined in @codepage,
+ * or -1 otherwise
+ * The value of @inlen after return is the number of octets consumed
+ * The value of @outlen after return is the number of octets produced.
+ */
+int singleByteToUTF8(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const encodingCodepage* codepage) {
 
+    unsigned char const* utf8table;
     unsigned char* outstart = out;
-    unsigned char* outend = out + *outlen;
+    unsigned char* outend;
     const unsigned char* instart = in;
-    const unsigned char* inend = in + *inlen;
-    const unsigned char* instop = inend;
-    unsigned int c = *in;
+    const unsigned char* inend;
+    int rc = 0;
 
-    while (in < inend && out < outend - 1) {
-        if (c >= 0x80) {
-            c = unicodetable [c - 0x80];
-            if (c == 0) {
-                /* undefined code point */
-                *outlen = out - outstart;
-                *inlen = in - instart;
-                return -1;
+    if (outlen == NULL || inlen == NULL || codepage == NULL) {
+        return -1;
+    }
+    if (in == NULL) {
+        *outlen = 0;
+        *inlen = 0;
+        return 0;
+    }
+    utf8table = codepage->toUtf8;
+    outend = out + *outlen;
+    inend = in + *inlen;
+    while (in < inend && out < outend) {
+        unsigned char const* utf8;
+        const unsigned char* instop;
+        unsigned char c = *in;
+        if (c < 0x80) {
+            int ascii = copyAscii(out, in, (inend - in < outend - out) ? inend - in : outend - out);
+            if (ascii == 0) {
+                /* less than a vector left */
+                *out = c;
+                ascii = 1;
             }
-            if (c < 0x800) {
-                *out++ = ((c >>  6) & 0x1F) | 0xC0;
-                *out++ = (c & 0x3F) | 0x80;
-            } else {
-                *out++ = ((c >>  12) & 0x0F) | 0xE0;
-                *out++ = ((c >>  6) & 0x3F) | 0x80;
-                *out++ = (c & 0x3F) | 0x80;
+            in += ascii;
+            out += ascii;
+            continue;
+        }
+        /* a run of other bytes, unchecked while there is room for 4 bytes each */
+        instop = in + (((outend - out) / 4 < inend - in) ? (outend - out) / 4 : inend - in);
+        while (in < instop && *in >= 0x80) {
+            utf8 = utf8table + (*in - 0x80) * 4;
+            if (utf8[3] == 0) {
+                break;
             }
+            memcpy(out, utf8, 4);
+            out += utf8[3];
             ++in;
-            c = *in;
         }
-        if (instop - in > outend - out) {
-            instop = in + (outend - out);
+        if (in == inend || *in < 0x80) {
+            continue;
         }
-        while (c < 0x80 && in < instop) {
-            *out++ = (unsigned char) c;
-            ++in;
-            c = *in;
+        utf8 = utf8table + (*in - 0x80) * 4;
+        if (utf8[3] == 0) {
+            /* undefined code point */
+            rc = -2;
+            break;
         }
-    }
-    if (in < inend && out < outend && c < 0x80) {
-        *out++ = (unsigned char) c;
+        if (outend - out < utf8[3]) {
+            break;
+        }
+        memcpy(out, utf8, utf8[3]);
+        out += utf8[3];
         ++in;
     }
     *outlen = out - outstart;
     *inlen = in - instart;
-    return 0;
+    return rc;
 }
 
 
-static unsigned short const xmlunicodetable_ISO8859_15 [128] = {
-    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
-    0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
-    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
-    0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d, 0x009e, 0x009f,
-    0x00a0, 0x00a1, 0x00a2, 0x00a3, 0x20ac, 0x00a5, 0x0160, 0x00a7,
-    0x0161, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
-    0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x017d, 0x00b5, 0x00b6, 0x00b7,
-    0x017e, 0x00b9, 0x00ba, 0x00bb, 0x0152, 0x0153, 0x0178, 0x00bf,
-    0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7,
-    0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
-    0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7,
-    0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
-    0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4, 0x00e5, 0x00e6, 0x00e7,
-    0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec, 0x00ed, 0x00ee, 0x00ef,
-    0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4, 0x00f5, 0x00f6, 0x00f7,
-    0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd, 0x00fe, 0x00ff,
-};
+/**
+ * Block conversion function of convertString() and convertBuffer(), with
+ * the codepage or whatever else it converts by in @context.
+ */
+typedef int (*blockConverter)(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const void* context);
 
 
-static unsigned char const xmltranscodetable_ISO8859_15 [48 + 6 * 64] = {
-    "\x00\x00\x01\x05\x00\x04\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x02\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x80\x81\x82\x83\x84\x85\x86\x87\x88\x89\x8a\x8b\x8c\x8d\x8e\x8f"
-    "\x90\x91\x92\x93\x94\x95\x96\x97\x98\x99\x9a\x9b\x9c\x9d\x9e\x9f"
-    "\xa0\xa1\xa2\xa3\x00\xa5\x00\xa7\x00\xa9\xaa\xab\xac\xad\xae\xaf"
-    "\xb0\xb1\xb2\xb3\x00\xb5\xb6\xb7\x00\xb9\xba\xbb\x00\x00\x00\xbf"
-    "\x00\x00\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xa4\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\xbc\xbd\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\xa6\xa8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
-    "\x00\x00\x00\x00\x00\x00\x00\x00\xbe\x00\x00\x00\x00\xb4\xb8\x00"
-    "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8\xc9\xca\xcb\xcc\xcd\xce\xcf"
-    "\xd0\xd1\xd2\xd3\xd4\xd5\xd6\xd7\xd8\xd9\xda\xdb\xdc\xdd\xde\xdf"
-    "\xe0\xe1\xe2\xe3\xe4\xe5\xe6\xe7\xe8\xe9\xea\xeb\xec\xed\xee\xef"
-    "\xf0\xf1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff"
-};
+static int
+UTF8ToLatin1Converter(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const void* context) {
+
+    (void) context;
+    return UTF8Toisolat1(out, outlen, in, inlen);
+}
+
+
+static int
+latin1ToUTF8Converter(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const void* context) {
+
+    (void) context;
+    return isolat1ToUTF8(out, outlen, in, inlen);
+}
+
+
+static int
+UTF8ToSingleByteConverter(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const void* context) {
+
+    /* the string and buffer functions take a cut off character for an error */
+    return UTF8ToSingleByteBlock(out, outlen, in, inlen, (const encodingCodepage*) context, 0);
+}
+
+
+static int
+singleByteToUTF8Converter(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const void* context) {
+
+    return singleByteToUTF8(out, outlen, in, inlen, (const encodingCodepage*) context);
+}
 
 
 int ISO8859_15ToUTF8(unsigned char* out, int *outlen,
     const unsigned char* in, int *inlen) {
 
-    return ISO8859xToUTF8(out, outlen, in, inlen, xmlunicodetable_ISO8859_15);
+    return singleByteToUTF8(out, outlen, in, inlen, &encodingISO8859_15);
 }
 
 
 int UTF8ToISO8859_15(unsigned char* out, int *outlen,
     const unsigned char* in, int *inlen) {
 
-    return UTF8ToISO8859x(out, outlen, in, inlen, xmltranscodetable_ISO8859_15);
+    /* fails on a cut off character, as it always has */
+    return UTF8ToSingleByteBlock(out, outlen, in, inlen, &encodingISO8859_15, 0);
 }
 
 
+/* bytes of a zero-terminated string looked at in one go, small enough to stay in cache */
+#define STRING_CHUNK 4096
+
+/**
+ * countAscii:
+ * @in:  a pointer to an array of bytes
+ * @len:  the length of @in
+ *
+ * Returns the number of US-ASCII bytes at the start of @in.
+ */
 static int
-getISO8859_15ToUTF8RequiredLength(const unsigned char* in,
-    int *inlen, int *outlen, int* transcodingNeeded) {
+countAscii(const unsigned char* in, int len) {
 
-    const unsigned char* instart = in;
-    const unsigned char* inend = in + *inlen;
-    int needToTranscode = 0;
-    unsigned int c = *in;
-    int numOut = 0;
+    int n = 0;
 
-    while (in < inend) {
-        if (c >= 0x80) {
-            c = xmlunicodetable_ISO8859_15[c - 0x80];
-            if (c == 0) {
-                /* undefined code point */
-                *outlen = numOut;
-                *inlen = in - instart;
-                *transcodingNeeded = needToTranscode;
-                return -1;
-            }
-            if (c < 0x800) {
-                numOut += 2;
-                needToTranscode = 1;
-            } else {
-                numOut += 3;
-                needToTranscode = 1;
-            }
-            ++in;
-            c = *in;
+#if defined(SIMD_SSE2)
+    while (len - n >= 16) {
+        unsigned int high = (unsigned int) _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) (in + n)));
+        if (high != 0) {
+            return n + lowestBit(high);
         }
-        while (c < 0x80 && in < inend) {
-            ++numOut;
-            ++in;
-            c = *in;
+        n += 16;
+    }
+#endif
+    while (n < len && in[n] < 0x80) {
+        ++n;
+    }
+    return n;
+}
+
+
+/**
+ * cutUtf8:
+ * @in:  a pointer to UTF-8 text
+ * @len:  the length of @in, at least 4
+ *
+ * Returns @len less the last character of @in if that may be incomplete,
+ * so that a chunk of UTF-8 ending there is not cut within a character.
+ */
+static int
+cutUtf8(const unsigned char* in, int len) {
+
+    int end = len;
+
+    if (in[end - 1] >= 0x80) {
+        /* leave the last character, complete or not, to the next chunk */
+        while (end > len - 4 && (in[end - 1] & 0xC0) == 0x80) {
+            --end;
+        }
+        if (in[end - 1] >= 0xC0) {
+            --end;
         }
-    } /* while */
-    if (in < inend && c < 0x80) {
-        ++numOut;
-        ++in;
     }
-    *outlen = numOut;
-    *inlen = in - instart;
-    *transcodingNeeded = needToTranscode;
-    return 0;
+    return end;
 }
 
 
+/**
+ * nextChunk:
+ * @in:  the rest of a zero-terminated string
+ * @last:  set to 1 if the chunk runs up to the terminator, 0 otherwise
+ * @utf8:  whether @in is UTF-8, which must not be cut within a character
+ *
+ * Returns the length of the next chunk of @in to convert, at most
+ * STRING_CHUNK. The terminator is found on the way (memchr stops at the
+ * first zero byte), so the string is not read twice from memory.
+ */
 static int
-getUTF8ToISO8859_15RequiredLength(const unsigned char* in,
-    int *inlen, int *outlen, int* transcodingNeeded) {
+nextChunk(const unsigned char* in, int* last, int utf8) {
+
+    const unsigned char* nul = memchr(in, 0, STRING_CHUNK);
+
+    if (nul != NULL) {
+        *last = 1;
+        return nul - in;
+    }
+    *last = 0;
+    return utf8 ? cutUtf8(in, STRING_CHUNK) : STRING_CHUNK;
+}
+
+
+/************************************************************************
+ *                                                                      *
+ *      Allocators for converted strings                                *
+ *                                                                      *
+ ************************************************************************/
+
+
+static void*
+mallocAllocate(void* context, size_t size) {
+
+    (void) context;
+    return malloc(size);
+}
+
+
+static void*
+mallocReallocate(void* context, void* ptr, size_t oldSize, size_t size) {
+
+    (void) context;
+    (void) oldSize;
+    return realloc(ptr, size);
+}
+
+
+static void
+mallocRelease(void* context, void* ptr) {
+
+    (void) context;
+    free(ptr);
+}
+
+
+/* what the functions without an allocator argument use */
+static const encodingAllocator defaultAllocator = {
+    mallocAllocate, mallocReallocate, mallocRelease, NULL
+};
+
+
+/* arena allocations are aligned like this, and blocks start with a header of that size */
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(n) (((n) + (ARENA_ALIGN - 1)) & ~(size_t) (ARENA_ALIGN - 1))
+#define ARENA_DEFAULT_BLOCK (64 * 1024)
+
+struct encodingArenaBlock {
+    struct encodingArenaBlock* next;    /* the block filled before this one */
+    size_t size;                        /* room after the header */
+    size_t used;
+    size_t last;                        /* offset of the latest allocation */
+};
+
+#define ARENA_HEADER ARENA_ROUND(sizeof(struct encodingArenaBlock))
+#define ARENA_DATA(block) ((unsigned char*) (block) + ARENA_HEADER)
+
+
+static void*
+arenaAllocate(void* context, size_t size) {
+
+    encodingArena* arena = (encodingArena*) context;
+    struct encodingArenaBlock* block = arena->head;
+
+    size = ARENA_ROUND(size);
+    if (size == 0) {
+        size = ARENA_ALIGN;
+    }
+    if (block == NULL || block->size - block->used < size) {
+        size_t room = (size > arena->blockSize) ? size : arena->blockSize;
+        if (room > (size_t) -1 - ARENA_HEADER) {
+            return NULL;
+        }
+        block = malloc(ARENA_HEADER + room);
+        if (block == NULL) {
+            return NULL;
+        }
+        block->next = arena->head;
+        block->size = room;
+        block->used = 0;
+        arena->head = block;
+    }
+    block->last = block->used;
+    block->used += size;
+    return ARENA_DATA(block) + block->last;
+}
+
+
+static void*
+arenaReallocate(void* context, void* ptr, size_t oldSize, size_t size) {
+
+    encodingArena* arena = (encodingArena*) context;
+    struct encodingArenaBlock* block = arena->head;
+    void* moved;
+
+    if (ptr == NULL) {
+        return arenaAllocate(context, size);
+    }
+    /* the latest allocation grows or shrinks in place */
+    if (block != NULL && ptr == ARENA_DATA(block) + block->last
+            && ARENA_ROUND(size) <= block->size - block->last) {
+        block->used = block->last + ((size > 0) ? ARENA_ROUND(size) : ARENA_ALIGN);
+        return ptr;
+    }
+    moved = arenaAllocate(context, size);
+    if (moved != NULL) {
+        memcpy(moved, ptr, (oldSize < size) ? oldSize : size);
+    }
+    return moved;
+}
+
+
+static void
+arenaRelease(void* context, void* ptr) {
+
+    encodingArena* arena = (encodingArena*) context;
+    struct encodingArenaBlock* block = arena->head;
+
+    /* only the latest allocation is given back, the rest waits for the reset */
+    if (block != NULL && ptr == ARENA_DATA(block) + block->last) {
+        block->used = block->last;
+    }
+}
+
+
+void encodingArenaInit(encodingArena* arena, size_t blockSize) {
+
+    arena->head = NULL;
+    arena->blockSize = (blockSize > 0) ? ARENA_ROUND(blockSize) : ARENA_DEFAULT_BLOCK;
+    arena->allocator.allocate = arenaAllocate;
+    arena->allocator.reallocate = arenaReallocate;
+    arena->allocator.release = arenaRelease;
+    arena->allocator.context = arena;
+}
 
-    const unsigned char* inend;
-    const unsigned char* instart = in;
-    int needToTranscode = 0;
-    int numOut = 0;
 
+void encodingArenaReset(encodingArena* arena) {
+
+    struct encodingArenaBlock* block = arena->head;
+    size_t total = 0;
+
+    if (block == NULL) {
+        return;
+    }
+    if (block->next == NULL) {
+        block->used = 0;
+        block->last = 0;
+        return;
+    }
+    /* outgrown: replace the blocks with one as large as all of them, when next needed */
+    while (block != NULL) {
+        struct encodingArenaBlock* next = block->next;
+        total += block->size;
+        free(block);
+        block = next;
+    }
+    arena->head = NULL;
+    arena->blockSize = total;
+}
+
+
+void encodingArenaFree(encodingArena* arena) {
+
+    struct encodingArenaBlock* block = arena->head;
+
+    while (block != NULL) {
+        struct encodingArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head = NULL;
+}
+
+
+/**
+ * convertString:
+ * @in:  a zero-terminated string
+ * @out:  set to the converted string, or to @in
+ * @wasTranscoded:  set to 1 if *out has been allocated
+ * @allocator:  where *out is allocated, NULL for malloc()
+ * @convert:  the block conversion function
+ * @context:  passed on to @convert
+ * @utf8:  whether @in is UTF-8
+ * @growth:  the most output bytes @convert produces per input byte
+ *
+ * Implements utf8ToLatin1() and friends in one pass over @in: the
+ * terminator is searched chunk by chunk, and a chunk is converted while
+ * it is still in cache. A string of nothing but US-ASCII is returned as
+ * it is; otherwise the output buffer grows as needed and is shrunk to
+ * fit at the end. Any conversion error fails the whole string, as the
+ * separate length pass used to.
+ *
+ * Returns 0 on success, -1 on error.
+ */
+static int
+convertString(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+              const encodingAllocator* allocator,
+              blockConverter convert, const void* context,
+              int utf8, int growth) {
+
+    unsigned char* buf;
+    unsigned char* shrunk;
+    size_t pos = 0;
+    size_t used;
+    size_t size;
+    int last = 0;
+    int len;
+
+    *wasTranscoded = 0;
+    if (out == NULL) {
+        return -1;
+    }
+    if (allocator == NULL) {
+        allocator = &defaultAllocator;
+    }
     if (in == NULL) {
-        /*
-         * initialization, nothing to do
-         */
-        *outlen = 0;
-        *inlen = 0;
-        *transcodingNeeded = 0;
+        *out = NULL;
         return 0;
     }
-    inend = in + (*inlen);
-    while (in < inend) {
-        unsigned char d = *in++;
-        if  (d < 0x80)  {
-            ++numOut;
-        } else if (d < 0xC0) {
-            /* trailing byte in leading position */
-            *outlen = numOut;
-            *inlen = in - instart - 1;
-            *transcodingNeeded = needToTranscode;
-            return -2;
-        } else if (d < 0xE0) {
-            unsigned char c;
-            if (!(in < inend)) {
-                /* trailing byte not in input buffer */
-                *outlen = numOut;
-                *inlen = in - instart - 1;
-                *transcodingNeeded = needToTranscode;
-                return -2;
-            }
-            c = *in++;
-            if ((c & 0xC0) != 0x80) {
-                /* not a trailing byte */
-                *outlen = numOut;
-                *inlen = in - instart - 2;
-                *transcodingNeeded = needToTranscode;
-                return -2;
-            }
-            c = c & 0x3F;
-            d = d & 0x1F;
-            d = xmltranscodetable_ISO8859_15[48 + c + xmltranscodetable_ISO8859_15[d] * 64];
-            if (d == 0) {
-                /* not in character set */
-                *outlen = numOut;
-                *inlen = in - instart - 2;
-                *transcodingNeeded = needToTranscode;
-                return -2;
-            }
-            ++numOut;
-            needToTranscode = 1;
-        } else if (d < 0xF0) {
-            unsigned char c1;
-            unsigned char c2;
-            if (!(in < inend - 1)) {
-                /* trailing bytes not in input buffer */
-                *outlen = numOut;
-                *inlen = in - instart - 1;
-                *transcodingNeeded = needToTranscode;
-                return -2;
-            }
-            c1 = *in++;
-            if ((c1 & 0xC0) != 0x80) {
-                /* not a trailing byte (c1) */
-                *outlen = numOut;
-                *inlen = in - instart - 2;
-                *transcodingNeeded = needToTranscode;
-                return -2;
-            }
-            c2 = *in++;
-            if ((c2 & 0xC0) != 0x80) {
-                /* not a trailing byte (c2) */
-                *outlen = numOut;
-                *inlen = in - instart - 2;
-                *transcodingNeeded = needToTranscode;
-                return -2;
-            }
-            c1 = c1 & 0x3F;
-            c2 = c2 & 0x3F;
-            d = d & 0x0F;
-            d = xmltranscodetable_ISO8859_15[48 + c2 + xmltranscodetable_ISO8859_15[48 + c1 + xmltranscodetable_ISO8859_15[32 + d] * 64] * 64];
-            if (d == 0) {
-                /* not in character set */
-                *outlen = numOut;
-                *inlen = in - instart - 3;
-                *transcodingNeeded = needToTranscode;
-                return -2;
+
+    /* US-ASCII prefix, the same in all these encodings */
+    do {
+        int ascii;
+        len = nextChunk(in + pos, &last, utf8);
+        ascii = countAscii(in + pos, len);
+        pos += ascii;
+        if (ascii < len) {
+            break;
+        }
+    } while (!last);
+
+    if (last && in[pos] == '\0' && pos > 0) {
+        /* 'in' needs no transcoding and is zero-terminated by assumption */
+        /* Note: Simply assigning the 'in' pointer assumes that 'in' doesn't get free'd afterwards !!! */
+        *out = (unsigned char*) in;
+        return 0;
+    }
+
+    size = (pos + STRING_CHUNK) * growth + 1;
+    buf = allocator->allocate(allocator->context, size);
+    if (buf == NULL) {
+        return -1;
+    }
+    memcpy(buf, in, pos);
+    used = pos;
+
+    while (in[pos] != '\0') {
+        int inlen;
+        int outlen;
+
+        len = nextChunk(in + pos, &last, utf8);
+        if (size - used < (size_t) len * growth + 1) {
+            unsigned char* grown;
+            size_t grownSize = 2 * size + (size_t) len * growth;
+            grown = allocator->reallocate(allocator->context, buf, size, grownSize);
+            if (grown == NULL) {
+                allocator->release(allocator->context, buf);
+                return -1;
             }
-            ++numOut;
-            needToTranscode = 1;
-        } else {
-            /* cannot transcode >= U+010000 */
-            *outlen = numOut;
-            *inlen = in - instart - 1;
-            *transcodingNeeded = needToTranscode;
-            return -2;
+            buf = grown;
+            size = grownSize;
+        }
+        inlen = len;
+        outlen = len * growth;
+        if (convert(buf + used, &outlen, in + pos, &inlen, context) != 0 || (inlen == 0 && !last)) {
+            allocator->release(allocator->context, buf);
+            return -1;
+        }
+        used += outlen;
+        pos += inlen;
+        if (last) {
+            /* a character cut off by the terminator is dropped */
+            break;
         }
     }
-    *outlen = numOut;
-    *inlen = in - instart;
-    *transcodingNeeded = needToTranscode;
+
+    buf[used] = '\0';
+    shrunk = allocator->reallocate(allocator->context, buf, size, used + 1);
+    *out = (shrunk != NULL) ? shrunk : buf;
+    *wasTranscoded = 1;
     return 0;
 }
 
 
+/**
+ * convertBuffer:
+ * @in:  a pointer to an array of bytes
+ * @inlen:  the length of @in
+ * @out:  a pointer to an array of bytes to store the result, or NULL
+ * @outsize:  the length of @out
+ * @outlen:  set to the length of the result
+ * @convert:  the block conversion function
+ * @context:  passed on to @convert
+ * @cut:  where a chunk of @in ending at a given length may end, NULL if anywhere
+ * @growth:  the most output bytes @convert produces per input byte, at most 4
+ *
+ * Implements utf8ToLatin1Buffer() and friends. @in is converted in chunks
+ * of STRING_CHUNK bytes (the block functions take int lengths), straight
+ * into @out while there is room for the worst case and through a buffer
+ * on the stack near the end of @out. Once @out is full the rest is still
+ * converted, to the stack buffer only, so that the exact size needed can
+ * be reported; no memory is allocated either way.
+ *
+ * Returns 0 on success, -1 on bad arguments, -2 if the transcoding fails
+ * or -3 if @out is too small.
+ */
+static int
+convertBuffer(const unsigned char* in, size_t inlen, unsigned char* out, size_t outsize, size_t* outlen,
+              blockConverter convert, const void* context,
+              int (*cut)(const unsigned char* in, int len), int growth) {
+
+    unsigned char scratch[STRING_CHUNK * 4];
+    size_t pos = 0;
+    size_t used = 0;
+
+    if (outlen == NULL || (in == NULL && inlen > 0) || (out == NULL && outsize > 0)) {
+        return -1;
+    }
+
+    while (pos < inlen) {
+        unsigned char* to;
+        int len = STRING_CHUNK;
+        int inchunk;
+        int outchunk;
+
+        if (inlen - pos <= STRING_CHUNK) {
+            len = (int) (inlen - pos);
+        } else if (cut != NULL) {
+            len = cut(in + pos, len);
+        }
+        /* the room left may be less than the result once out is full */
+        to = (used <= outsize && outsize - used >= (size_t) len * growth) ? out + used : scratch;
+        inchunk = len;
+        outchunk = len * growth;
+        if (convert(to, &outchunk, in + pos, &inchunk, context) != 0 || inchunk != len) {
+            /* malformed, not representable, or a character cut off at the end */
+            return -2;
+        }
+        if (to == scratch && used < outsize) {
+            memcpy(out + used, scratch, (outsize - used < (size_t) outchunk) ? outsize - used : (size_t) outchunk);
+        }
+        used += outchunk;
+        pos += len;
+    }
+
+    *outlen = used;
+    return (used <= outsize) ? 0 : -3;
+}
+
+
 /**
  * Attempt to convert UTF-8 encoded 'in' to Latin-9 encoded *out.
  * Correctly sized memory for *out will be malloc'ed automatically
@@ -698,59 +1604,41 @@ getUTF8ToISO8859_15RequiredLength(const unsigned char* in,
  */
 int utf8ToLatin9(const unsigned char* in, unsigned char** out, int* wasTranscoded) {
 
-    int byteLenIn = 0;
-    int byteLenOut = 0;
-    int szLenOut = 0;
-    int needToTranscode = 0;
+    return convertString(in, out, wasTranscoded, NULL, UTF8ToSingleByteConverter, &encodingISO8859_15, 1, 1);
+}
 
-    if (out == NULL) {
-        *wasTranscoded = 0;
-        return -1;
-    }
-    if (in == NULL) {
-        *out = NULL;
-        *wasTranscoded = 0;
-        return 0;
-    }
 
-    /* Count bytes in 'in' */
-    /* UTF-8 strings shouldn't contain the byte 0 (other than used as a terminator) */
-    byteLenIn = strlen((const char*) in);
-
-    if (byteLenIn > 0) {
-        if (getUTF8ToISO8859_15RequiredLength(in, &byteLenIn, &byteLenOut, &needToTranscode) == 0) {
-            if (needToTranscode) {
-                szLenOut = byteLenOut + 1;
-                *out = malloc(szLenOut * sizeof(unsigned char));
-                if (UTF8ToISO8859_15(*out, &byteLenOut, in, &byteLenIn) == 0) {
-                    /* transcoding succeeded, zero-terminate *out */
-                    (*out)[byteLenOut] = '\0';
-                    *wasTranscoded = 1;
-                } else {
-                    /* transcoding didn't succeed */
-                    free(*out);
-                    *wasTranscoded = 0;
-                    return -1;
-                }
-            } else {
-                /* 'in' is already in Latin-9 encoding and zero-terminated by assumption */
-                /* Note: Simply assigning the 'in' pointer assumes that 'in' doesn't get free'd afterwards !!! */
-                *out = (unsigned char*) in;
-                *wasTranscoded = 0;
-            }
-        } else {
-            /* length determination didn't succeed */
-            *wasTranscoded = 0;
-            return -1;
-        }
-    } else {
-        /* in is an empty string */
-        *out = malloc(1 * sizeof(unsigned char));
-        *out = '\0';
-        *wasTranscoded = 1;
-    }
+/**
+ * utf8ToLatin9() with *out taken from 'allocator' rather than malloc'ed (NULL
+ * selects malloc). If 'wasTranscoded' == 1, *out is to be given back
+ * with allocator->release(), or with the arena it came from.
+ */
+int utf8ToLatin9Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingAllocator* allocator) {
 
-    return 0;
+    return convertString(in, out, wasTranscoded, allocator, UTF8ToSingleByteConverter, &encodingISO8859_15, 1, 1);
+}
+
+
+/**
+ * Convert the UTF-8 encoded 'inlen' bytes at 'in' to Latin-9 in the
+ * caller's buffer 'out' of 'outsize' bytes. Nothing is allocated and 'in'
+ * need not be zero-terminated; zero bytes are converted like any other
+ * US-ASCII character, and no terminator is appended to 'out'.
+ *
+ * On return *outlen holds the length of the result. Calling it with
+ * out == NULL and outsize == 0 just measures it; outsize == inlen is
+ * always enough.
+ *
+ * Returns rc == 0 on success, rc == -3 if 'out' is too small (*outlen is
+ * then the size needed, and 'out' holds what fitted), rc == -2 if 'in'
+ * cannot be transcoded (malformed or truncated UTF-8, or a character not
+ * in Latin-9), or rc == -1 on invalid arguments.
+ */
+int utf8ToLatin9Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen) {
+
+    return convertBuffer(in, inlen, out, outsize, outlen, UTF8ToSingleByteConverter, &encodingISO8859_15, cutUtf8, 1);
 }
 
 
@@ -775,65 +1663,104 @@ int utf8ToLatin9(const unsigned char* in, unsigned char** out, int* wasTranscode
  */
 int latin9ToUtf8(const unsigned char* in, unsigned char** out, int* wasTranscoded) {
 
-    int byteLenIn = 0;
-    int byteLenOut = 0;
-    int szLenOut = 0;
-    int needToTranscode = 0;
+    return convertString(in, out, wasTranscoded, NULL, singleByteToUTF8Converter, &encodingISO8859_15, 0, 3);
+}
 
-    if (out == NULL) {
-        *wasTranscoded = 0;
-        return -1;
-    }
-    if (in == NULL) {
-        *out = NULL;
-        *wasTranscoded = 0;
-        return 0;
-    }
 
-    /* Count bytes in 'in' */
-    byteLenIn = strlen((const char*) in);
-
-    if (byteLenIn > 0) {
-        if (getISO8859_15ToUTF8RequiredLength(in, &byteLenIn, &byteLenOut, &needToTranscode) == 0) {
-            if (needToTranscode) {
-                szLenOut = byteLenOut + 1;
-                *out = malloc(szLenOut * sizeof(unsigned char));
-                if (ISO8859_15ToUTF8(*out, &byteLenOut, in, &byteLenIn) == 0) {
-                    /* transcoding succeeded, zero-terminate *out */
-                    (*out)[byteLenOut] = '\0';
-                    *wasTranscoded = 1;
-                } else {
-                    /* transcoding didn't succeed */
-                    free(*out);
-                    *wasTranscoded = 0;
-                    return -1;
-                }
-            } else {
-                /* 'in' contains only US-ASCII encoded characters and is zero-terminated by assumption */
-                /* Note: Simply assigning the 'in' pointer assumes that 'in' doesn't get free'd afterwards !!! */
-                *out = (unsigned char*) in;
-                *wasTranscoded = 0;
-            }
-        } else {
-            /* length determination didn't succeed */
-            *wasTranscoded = 0;
-            return -1;
-        }
-    } else {
-        /* in is an empty string */
-        *out = malloc(1 * sizeof(unsigned char));
-        *out = '\0';
-        *wasTranscoded = 1;
+/**
+ * latin9ToUtf8() with *out taken from 'allocator' rather than malloc'ed (NULL
+ * selects malloc). If 'wasTranscoded' == 1, *out is to be given back
+ * with allocator->release(), or with the arena it came from.
+ */
+int latin9ToUtf8Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingAllocator* allocator) {
+
+    return convertString(in, out, wasTranscoded, allocator, singleByteToUTF8Converter, &encodingISO8859_15, 0, 3);
+}
+
+
+/**
+ * Convert the Latin-9 encoded 'inlen' bytes at 'in' to UTF-8 in the
+ * caller's buffer 'out' of 'outsize' bytes. Nothing is allocated and 'in'
+ * need not be zero-terminated; zero bytes are converted like any other
+ * US-ASCII character, and no terminator is appended to 'out'.
+ *
+ * On return *outlen holds the length of the result. Calling it with
+ * out == NULL and outsize == 0 just measures it; outsize == 3 * inlen is
+ * always enough.
+ *
+ * Returns rc == 0 on success, rc == -3 if 'out' is too small (*outlen is
+ * then the size needed, and 'out' holds what fitted), rc == -2 if 'in'
+ * cannot be transcoded (a byte undefined in Latin-9), or rc == -1 on
+ * invalid arguments.
+ */
+int latin9ToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen) {
+
+    return convertBuffer(in, inlen, out, outsize, outlen, singleByteToUTF8Converter, &encodingISO8859_15, NULL, 3);
+}
+
+
+/**
+ * utf8ToLatin9() for any single byte codepage; see encoding.h.
+ */
+int utf8ToCodepage(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingCodepage* codepage) {
+
+    return utf8ToCodepageAlloc(in, out, wasTranscoded, codepage, NULL);
+}
+
+
+int utf8ToCodepageAlloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingCodepage* codepage, const encodingAllocator* allocator) {
+
+    if (codepage == NULL) {
+        return -1;
     }
+    return convertString(in, out, wasTranscoded, allocator, UTF8ToSingleByteConverter, codepage, 1, 1);
+}
 
-    return 0;
+
+int utf8ToCodepageBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen,
+    const encodingCodepage* codepage) {
+
+    if (codepage == NULL) {
+        return -1;
+    }
+    return convertBuffer(in, inlen, out, outsize, outlen, UTF8ToSingleByteConverter, codepage, cutUtf8, 1);
 }
 
-/*
- * (SPZ) TODO: utf8ToLatin9() and latin9ToUtf8() could be collapsed
- * into one function using function pointers for the applied conversion
- * and length functions.
+
+/**
+ * latin9ToUtf8() for any single byte codepage; see encoding.h.
  */
+int codepageToUtf8(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingCodepage* codepage) {
+
+    return codepageToUtf8Alloc(in, out, wasTranscoded, codepage, NULL);
+}
+
+
+int codepageToUtf8Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingCodepage* codepage, const encodingAllocator* allocator) {
+
+    if (codepage == NULL) {
+        return -1;
+    }
+    return convertString(in, out, wasTranscoded, allocator, singleByteToUTF8Converter, codepage, 0, 3);
+}
+
+
+int codepageToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen,
+    const encodingCodepage* codepage) {
+
+    if (codepage == NULL) {
+        return -1;
+    }
+    return convertBuffer(in, inlen, out, outsize, outlen, singleByteToUTF8Converter, codepage, NULL, 3);
+}
 
 
 /**
@@ -844,308 +1771,61 @@ int latin9ToUtf8(const unsigned char* in, unsigned char** out, int* wasTranscode
  * @inlen:  the length of @in
  *
  * Take a block of UTF-8 chars in and try to convert it to an
- * Windows-1252 block of chars out.
+ * Windows-1252 block of chars out, looked up in the table of
+ * encodingCp1252, which substitutes an inverted question mark for
+ * characters it lacks.
  *
  * Returns 0 if success, -2 if the transcoding fails, or -1 otherwise
  * The value of @inlen after return is the number of octets consumed
  *     if the return value is positive, else unpredictable.
- * The value of @outlen after return is the number of octets consumed.
+ * The value of @outlen after return is the number of octets produced.
  */
 int utf8ToCp1252(unsigned char* out, int *outlen,
               const unsigned char* in, int *inlen) {
 
-    const unsigned char* processed = in;
-    const unsigned char* outend;
-    const unsigned char* outstart = out;
-    const unsigned char* instart = in;
-    const unsigned char* inend;
-    unsigned char subs;
-    unsigned int c, d;
-    int trailing;
-
-    if (in == NULL) {
-        /*
-         * initialization, nothing to do
-         */
-        *outlen = 0;
-        *inlen = 0;
-        return 0;
-    }
-
-    inend = in + (*inlen);
-    outend = out + (*outlen);
-    while (in < inend) {
-        d = *in++;
-        if (d < 0x80) {
-            c = d;
-            trailing = 0;
-        } else if (d < 0xC0) {
-            /* trailing byte in leading position */
-            *outlen = out - outstart;
-            *inlen = processed - instart;
-            return -2;
-        } else if (d < 0xE0) {
-            c = d & 0x1F;
-            trailing = 1;
-        } else if (d < 0xF0) {
-            c = d & 0x0F;
-            trailing = 2;
-        } else if (d < 0xF8) {
-            c = d & 0x07;
-            trailing = 3;
-        } else {
-            /* no chance for this in Cp1252 */
-            *outlen = out - outstart;
-            *inlen = processed - instart;
-            return -2;
-        }
-
-        if (inend - in < trailing) {
-            break;
-        }
-
-        for ( ; trailing; trailing--) {
-            if (in >= inend) {
-                break;
-            }
-            if (((d= *in++) & 0xC0) != 0x80) {
-                *outlen = out - outstart;
-                *inlen = processed - instart;
-                return -2;
-            }
-            c <<= 6;
-            c |= d & 0x3F;
-        }
-
-        /* assertion: c is a single UTF-4 value */
-        if (c <= 0xFF) {
-            if (out >= outend) {
-                break;
-            }
-            *out++ = (unsigned char) c;
-        } else {
-            /* attempt to fix this for Cp1252 */
-            if (out >= outend) {
-                break;
-            }
-            /*
-             * substitute the known Windows-1252 codes in the
-             * unused range 0x80 - 0x9F, otherwise use an inverted
-             * question mark as the replacement character.
-             */
-            switch (c) {
-                case 0x0152:
-                    subs = (unsigned char) 0x8C;
-                    break;
-                case 0x0153:
-                    subs = (unsigned char) 0x9C;
-                    break;
-                case 0x0160:
-                    subs = (unsigned char) 0x8A;
-                    break;
-                case 0x0161:
-                    subs = (unsigned char) 0x9A;
-                    break;
-                case 0x0178:
-                    subs = (unsigned char) 0x9F;
-                    break;
-                case 0x017D:
-                    subs = (unsigned char) 0x8E;
-                    break;
-                case 0x017E:
-                    subs = (unsigned char) 0x9E;
-                    break;
-                case 0x0192:
-                    subs = (unsigned char) 0x83;
-                    break;
-                case 0x02c6:
-                    subs = (unsigned char) 0x88;
-                    break;
-                case 0x02dc:
-                    subs = (unsigned char) 0x98;
-                    break;
-                case 0x2013:
-                    subs = (unsigned char) 0x96;
-                    break;
-                case 0x2014:
-                    subs = (unsigned char) 0x97;
-                    break;
-                case 0x2018:
-                    subs = (unsigned char) 0x91;
-                    break;
-                case 0x2019:
-                    subs = (unsigned char) 0x92;
-                    break;
-                case 0x201a:
-                    subs = (unsigned char) 0x82;
-                    break;
-                case 0x201c:
-                    subs = (unsigned char) 0x93;
-                    break;
-                case 0x201d:
-                    subs = (unsigned char) 0x94;
-                    break;
-                case 0x201e:
-                    subs = (unsigned char) 0x84;
-                    break;
-                case 0x2020:
-                    subs = (unsigned char) 0x86;
-                    break;
-                case 0x2021:
-                    subs = (unsigned char) 0x87;
-                    break;
-                case 0x2022:
-                    subs = (unsigned char) 0x95;
-                    break;
-                case 0x2026:
-                    subs = (unsigned char) 0x85;
-                    break;
-                case 0x2030:
-                    subs = (unsigned char) 0x89;
-                    break;
-                case 0x2039:
-                    subs = (unsigned char) 0x8B;
-                    break;
-                case 0x203a:
-                    subs = (unsigned char) 0x9B;
-                    break;
-                case 0x20AC:
-                    subs = (unsigned char) 0x80;
-                    break;
-                case 0x2122:
-                    subs = (unsigned char) 0x99;
-                    break;
-                default:
-                    /* inverted question mark */
-                    subs = (unsigned char) 0xBF;
-            }
-            *out++ = subs;
-        }
-        processed = in;
-    } /* while */
-    *outlen = out - outstart;
-    *inlen = processed - instart;
-    return 0;
+    return UTF8ToSingleByte(out, outlen, in, inlen, &encodingCp1252);
 }
 
 
-static int
-getISOLatin1ToUtf8_RequiredLength(const unsigned char* in, int *inlen,
-    int *outlen, int* transcodingNeeded) {
-
-    const unsigned char* base = in;
-    const unsigned char* inend;
-    int needToTranscode = 0;
-    int numOut = 0;
-
-    if (in == NULL) {
-        /*
-         * initialization, nothing to do
-         */
-        *outlen = 0;
-        *inlen = 0;
-        *transcodingNeeded = 0;
-        return 0;
-    }
-    inend = in + (*inlen);
+/**
+ * Cp1252ToUtf8:
+ * @out:  a pointer to an array of bytes to store the result
+ * @outlen:  the length of @out
+ * @in:  a pointer to an array of Windows-1252 chars
+ * @inlen:  the length of @in
+ *
+ * Take a block of Windows-1252 chars in and convert it to an UTF-8
+ * block of chars out.
+ * Returns 0 if success, or -1 otherwise
+ * The value of @inlen after return is the number of octets consumed
+ * The value of @outlen after return is the number of octets produced.
+ */
+int Cp1252ToUtf8(unsigned char* out, int *outlen,
+              const unsigned char* in, int *inlen) {
 
-    while (in < inend) {
-        if (*in >= 0x80) {
-            numOut += 2;
-            needToTranscode = 1;
-            ++in;
-        }
-        while (in < inend && *in < 0x80) {
-            ++in;
-            ++numOut;
-        }
-    }
-    if (in < inend && *in < 0x80) {
-        ++in;
-        ++numOut;
-    }
-    *outlen = numOut;
-    *inlen = in - base;
-    *transcodingNeeded = needToTranscode;
-    return 0;
+    return singleByteToUTF8(out, outlen, in, inlen, &encodingCp1252);
 }
 
 
-static int
-getUtf8ToISOLatin1_RequiredLength(const unsigned char* in,
-    int *inlen, int *outlen, int* transcodingNeeded) {
-
-    const unsigned char* processed = in;
-    const unsigned char* instart = in;
-    const unsigned char* inend;
-    unsigned int d;
-    int trailing;
-    int needToTranscode = 0;
-    int numOut = 0;
-
-    if (in == NULL) {
-        /*
-         * initialization, nothing to do
-         */
-        *outlen = 0;
-        *inlen = 0;
-        *transcodingNeeded = 0;
-        return 0;
-    }
-    inend = in + (*inlen);
-
-    while (in < inend) {
-        d = *in++;
-        if (d < 0x80) {
-            trailing = 0;
-        } else if (d < 0xC0) {
-            /* trailing byte in leading position */
-            *outlen = numOut;
-            *inlen = processed - instart;
-            *transcodingNeeded = needToTranscode;
-            return -2;
-        } else if (d < 0xE0) {
-            needToTranscode = 1;
-            trailing = 1;
-        } else if (d < 0xF0) {
-            needToTranscode = 1;
-            trailing = 2;
-        } else if (d < 0xF8) {
-            needToTranscode = 1;
-            trailing = 3;
-        } else {
-            /* no chance for this in IsoLatin-1 */
-            *outlen = numOut;
-            *inlen = processed - instart;
-            *transcodingNeeded = needToTranscode;
-            return -2;
-        }
-
-        if (inend - in < trailing) {
-            break;
-        }
+/**
+ * Convert the UTF-8 encoded 'inlen' bytes at 'in' to Windows-1252 in the
+ * caller's buffer 'out'; see encoding.h.
+ */
+int utf8ToCp1252Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen) {
 
-        for ( ; trailing; trailing--) {
-            if (in >= inend) {
-                break;
-            }
-            if (((d = *in++) & 0xC0) != 0x80) {
-                *outlen = numOut;
-                *inlen = processed - instart;
-                *transcodingNeeded = needToTranscode;
-                return -2;
-            }
-        }
+    return convertBuffer(in, inlen, out, outsize, outlen, UTF8ToSingleByteConverter, &encodingCp1252, cutUtf8, 1);
+}
 
-        ++numOut;
-        processed = in;
 
-    } /* while */
+/**
+ * Convert the Windows-1252 encoded 'inlen' bytes at 'in' to UTF-8 in the
+ * caller's buffer 'out'; see encoding.h.
+ */
+int cp1252ToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen) {
 
-    *outlen = numOut;
-    *inlen = processed - instart;
-    *transcodingNeeded = needToTranscode;
-    return 0;
+    return convertBuffer(in, inlen, out, outsize, outlen, singleByteToUTF8Converter, &encodingCp1252, NULL, 3);
 }
 
 
@@ -1170,59 +1850,41 @@ getUtf8ToISOLatin1_RequiredLength(const unsigned char* in,
  */
 int utf8ToLatin1(const unsigned char* in, unsigned char** out, int* wasTranscoded) {
 
-    int byteLenIn = 0;
-    int byteLenOut = 0;
-    int szLenOut = 0;
-    int needToTranscode = 0;
+    return convertString(in, out, wasTranscoded, NULL, UTF8ToLatin1Converter, NULL, 1, 1);
+}
 
-    if (out == NULL) {
-        *wasTranscoded = 0;
-        return -1;
-    }
-    if (in == NULL) {
-        *out = NULL;
-        *wasTranscoded = 0;
-        return 0;
-    }
 
-    /* Count bytes in 'in' */
-    /* UTF-8 strings shouldn't contain the byte 0 (other than used as a terminator) */
-    byteLenIn = strlen((const char*) in);
-
-    if (byteLenIn > 0) {
-        if (getUtf8ToISOLatin1_RequiredLength(in, &byteLenIn, &byteLenOut, &needToTranscode) == 0) {
-            if (needToTranscode) {
-                szLenOut = byteLenOut + 1;
-                *out = malloc(szLenOut * sizeof(unsigned char));
-                if (UTF8Toisolat1(*out, &byteLenOut, in, &byteLenIn) == 0) {
-                    /* transcoding succeeded, zero-terminate *out */
-                    (*out)[byteLenOut] = '\0';
-                    *wasTranscoded = 1;
-                } else {
-                    /* transcoding didn't succeed */
-                    free(*out);
-                    *wasTranscoded = 0;
-                    return -1;
-                }
-            } else {
-                /* 'in' is already in Latin-1 encoding and zero-terminated by assumption */
-                /* Note: Simply assigning the 'in' pointer assumes that 'in' doesn't get free'd afterwards !!! */
-                *out = (unsigned char*) in;
-                *wasTranscoded = 0;
-            }
-        } else {
-            /* length determination didn't succeed */
-            *wasTranscoded = 0;
-            return -1;
-        }
-    } else {
-        /* in is an empty string */
-        *out = malloc(1 * sizeof(unsigned char));
-        *out = '\0';
-        *wasTranscoded = 1;
-    }
+/**
+ * utf8ToLatin1() with *out taken from 'allocator' rather than malloc'ed (NULL
+ * selects malloc). If 'wasTranscoded' == 1, *out is to be given back
+ * with allocator->release(), or with the arena it came from.
+ */
+int utf8ToLatin1Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingAllocator* allocator) {
 
-    return 0;
+    return convertString(in, out, wasTranscoded, allocator, UTF8ToLatin1Converter, NULL, 1, 1);
+}
+
+
+/**
+ * Convert the UTF-8 encoded 'inlen' bytes at 'in' to Latin-1 in the
+ * caller's buffer 'out' of 'outsize' bytes. Nothing is allocated and 'in'
+ * need not be zero-terminated; zero bytes are converted like any other
+ * US-ASCII character, and no terminator is appended to 'out'.
+ *
+ * On return *outlen holds the length of the result. Calling it with
+ * out == NULL and outsize == 0 just measures it; outsize == inlen is
+ * always enough.
+ *
+ * Returns rc == 0 on success, rc == -3 if 'out' is too small (*outlen is
+ * then the size needed, and 'out' holds what fitted), rc == -2 if 'in'
+ * cannot be transcoded (malformed or truncated UTF-8), or rc == -1 on
+ * invalid arguments.
+ */
+int utf8ToLatin1Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen) {
+
+    return convertBuffer(in, inlen, out, outsize, outlen, UTF8ToLatin1Converter, NULL, cutUtf8, 1);
 }
 
 
@@ -1247,63 +1909,961 @@ int utf8ToLatin1(const unsigned char* in, unsigned char** out, int* wasTranscode
  */
 int latin1ToUtf8(const unsigned char* in, unsigned char** out, int* wasTranscoded) {
 
-    int byteLenIn = 0;
-    int byteLenOut = 0;
-    int szLenOut = 0;
-    int needToTranscode = 0;
+    return convertString(in, out, wasTranscoded, NULL, latin1ToUTF8Converter, NULL, 0, 2);
+}
 
-    if (out == NULL) {
-        *wasTranscoded = 0;
-        return -1;
+
+/**
+ * latin1ToUtf8() with *out taken from 'allocator' rather than malloc'ed (NULL
+ * selects malloc). If 'wasTranscoded' == 1, *out is to be given back
+ * with allocator->release(), or with the arena it came from.
+ */
+int latin1ToUtf8Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingAllocator* allocator) {
+
+    return convertString(in, out, wasTranscoded, allocator, latin1ToUTF8Converter, NULL, 0, 2);
+}
+
+
+/**
+ * Convert the Latin-1 encoded 'inlen' bytes at 'in' to UTF-8 in the
+ * caller's buffer 'out' of 'outsize' bytes. Nothing is allocated and 'in'
+ * need not be zero-terminated; zero bytes are converted like any other
+ * US-ASCII character, and no terminator is appended to 'out'.
+ *
+ * On return *outlen holds the length of the result. Calling it with
+ * out == NULL and outsize == 0 just measures it; outsize == 2 * inlen is
+ * always enough.
+ *
+ * Returns rc == 0 on success, rc == -3 if 'out' is too small (*outlen is
+ * then the size needed, and 'out' holds what fitted), rc == -2 if 'in'
+ * cannot be transcoded (not for Latin-1), or rc == -1 on invalid
+ * arguments.
+ */
+int latin1ToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen) {
+
+    return convertBuffer(in, inlen, out, outsize, outlen, latin1ToUTF8Converter, NULL, NULL, 2);
+}
+
+
+
+/************************************************************************
+ *                                                                      *
+ *      UTF-16 and UTF-32                                               *
+ *                                                                      *
+ ************************************************************************/
+
+
+/* bytes per code unit */
+#define UNIT_SIZE(form) (((form) == encodingUTF16LE || (form) == encodingUTF16BE) ? 2 : 4)
+
+
+/* what the UTF-16 and UTF-32 block converters work with */
+typedef struct {
+    encodingUnicodeForm form;
+    const encodingCodepage* codepage;   /* the single byte side, NULL for Latin-1 */
+} unicodeContext;
+
+
+#if defined(SIMD_SSE2)
+/* bytes swapped in each 16 bit lane */
+static __m128i
+swap16(__m128i v) {
+
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+
+/* bytes swapped in each 32 bit lane */
+static __m128i
+swap32(__m128i v) {
+
+    return swap16(_mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1));
+}
+#endif /* SIMD_SSE2 */
+
+
+/**
+ * narrowUnits:
+ * @out:  where to store the bytes
+ * @in:  UTF-16 or UTF-32 code units
+ * @units:  the number of code units at @in, and of bytes of room at @out
+ * @form:  the form of @in
+ * @limit:  0x80 or 0x100, the first code point not to store
+ *
+ * Store the run of code units below @limit at the start of @in as bytes,
+ * 16 at a time, stopping at the first other unit or less than 16 units
+ * before @units.
+ * Returns the number of code units stored.
+ */
+static int
+narrowUnits(unsigned char* out, const unsigned char* in, int units,
+            encodingUnicodeForm form, unsigned int limit) {
+
+    int n = 0;
+
+#if defined(SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    if (UNIT_SIZE(form) == 2) {
+        const __m128i high = _mm_set1_epi16((short) (0x10000 - limit));
+        while (units - n >= 16) {
+            __m128i a = _mm_loadu_si128((const __m128i*) (in + 2 * n));
+            __m128i b = _mm_loadu_si128((const __m128i*) (in + 2 * n + 16));
+            unsigned int below;
+            if (form == encodingUTF16BE) {
+                a = swap16(a);
+                b = swap16(b);
+            }
+            below = (unsigned int) _mm_movemask_epi8(_mm_packs_epi16(
+                        _mm_cmpeq_epi16(_mm_and_si128(a, high), zero),
+                        _mm_cmpeq_epi16(_mm_and_si128(b, high), zero)));
+            /* units at and above limit saturate, and are not counted */
+            _mm_storeu_si128((__m128i*) (out + n), _mm_packus_epi16(a, b));
+            if (below != 0xFFFF) {
+                return n + lowestBit(~below);
+            }
+            n += 16;
+        }
+    } else {
+        const __m128i high = _mm_set1_epi32((int) (0 - limit));
+        while (units - n >= 16) {
+            __m128i a = _mm_loadu_si128((const __m128i*) (in + 4 * n));
+            __m128i b = _mm_loadu_si128((const __m128i*) (in + 4 * n + 16));
+            __m128i c = _mm_loadu_si128((const __m128i*) (in + 4 * n + 32));
+            __m128i d = _mm_loadu_si128((const __m128i*) (in + 4 * n + 48));
+            unsigned int below;
+            if (form == encodingUTF32BE) {
+                a = swap32(a);
+                b = swap32(b);
+                c = swap32(c);
+                d = swap32(d);
+            }
+            below = (unsigned int) _mm_movemask_epi8(_mm_packs_epi16(
+                        _mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(a, high), zero),
+                                        _mm_cmpeq_epi32(_mm_and_si128(b, high), zero)),
+                        _mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(c, high), zero),
+                                        _mm_cmpeq_epi32(_mm_and_si128(d, high), zero))));
+            _mm_storeu_si128((__m128i*) (out + n),
+                             _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+            if (below != 0xFFFF) {
+                return n + lowestBit(~below);
+            }
+            n += 16;
+        }
     }
-    if (in == NULL) {
-        *out = NULL;
-        *wasTranscoded = 0;
+#else
+    (void) out;
+    (void) in;
+    (void) units;
+    (void) form;
+    (void) limit;
+#endif
+    return n;
+}
+
+
+/**
+ * widenBytes:
+ * @out:  where to store the code units
+ * @in:  bytes below 0x100 that are their own code points
+ * @len:  the length of @in, and the room at @out in code units
+ * @form:  the form of @out
+ * @ascii:  whether to stop at the first byte >= 0x80
+ *
+ * Store the bytes at the start of @in as code units, 16 at a time,
+ * stopping at the first byte >= 0x80 if @ascii is set or less than 16
+ * bytes before @len.
+ * Returns the number of bytes stored.
+ */
+static int
+widenBytes(unsigned char* out, const unsigned char* in, int len,
+           encodingUnicodeForm form, int ascii) {
+
+    int n = 0;
+
+#if defined(SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    while (len - n >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (in + n));
+        unsigned int high = ascii ? (unsigned int) _mm_movemask_epi8(v) : 0;
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        if (UNIT_SIZE(form) == 2) {
+            if (form == encodingUTF16BE) {
+                lo = swap16(lo);
+                hi = swap16(hi);
+            }
+            _mm_storeu_si128((__m128i*) (out + 2 * n), lo);
+            _mm_storeu_si128((__m128i*) (out + 2 * n + 16), hi);
+        } else {
+            __m128i a = _mm_unpacklo_epi16(lo, zero);
+            __m128i b = _mm_unpackhi_epi16(lo, zero);
+            __m128i c = _mm_unpacklo_epi16(hi, zero);
+            __m128i d = _mm_unpackhi_epi16(hi, zero);
+            if (form == encodingUTF32BE) {
+                a = swap32(a);
+                b = swap32(b);
+                c = swap32(c);
+                d = swap32(d);
+            }
+            _mm_storeu_si128((__m128i*) (out + 4 * n), a);
+            _mm_storeu_si128((__m128i*) (out + 4 * n + 16), b);
+            _mm_storeu_si128((__m128i*) (out + 4 * n + 32), c);
+            _mm_storeu_si128((__m128i*) (out + 4 * n + 48), d);
+        }
+        if (high != 0) {
+            return n + lowestBit(high);
+        }
+        n += 16;
+    }
+#else
+    (void) out;
+    (void) in;
+    (void) len;
+    (void) form;
+    (void) ascii;
+#endif
+    return n;
+}
+
+
+#if defined(SIMD_SSE2)
+/**
+ * loadUnits:
+ * @in:  8 code units
+ * @form:  the form of @in
+ * @units:  set to the code units, 16 bits each
+ *
+ * Returns whether all 8 code units fit 16 bits, as UTF-16 ones always do.
+ */
+static int
+loadUnits(const unsigned char* in, encodingUnicodeForm form, __m128i* units) {
+
+    __m128i a = _mm_loadu_si128((const __m128i*) in);
+    __m128i b;
+
+    if (UNIT_SIZE(form) == 2) {
+        *units = (form == encodingUTF16BE) ? swap16(a) : a;
+        return 1;
+    }
+    b = _mm_loadu_si128((const __m128i*) (in + 16));
+    if (form == encodingUTF32BE) {
+        a = swap32(a);
+        b = swap32(b);
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_srli_epi32(_mm_or_si128(a, b), 16), _mm_setzero_si128())) != 0xFFFF) {
         return 0;
     }
+    /* sign extended, the low halves pass the signed saturation unchanged */
+    *units = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16),
+                             _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+    return 1;
+}
+
+
+/* store 8 code units of 16 bits in @form, 16 or 32 bytes */
+static void
+storeUnits(unsigned char* out, __m128i units, encodingUnicodeForm form) {
+
+    if (UNIT_SIZE(form) == 2) {
+        _mm_storeu_si128((__m128i*) out, (form == encodingUTF16BE) ? swap16(units) : units);
+    } else {
+        __m128i a = _mm_unpacklo_epi16(units, _mm_setzero_si128());
+        __m128i b = _mm_unpackhi_epi16(units, _mm_setzero_si128());
+        if (form == encodingUTF32BE) {
+            a = swap32(a);
+            b = swap32(b);
+        }
+        _mm_storeu_si128((__m128i*) out, a);
+        _mm_storeu_si128((__m128i*) (out + 16), b);
+    }
+}
+#endif /* SIMD_SSE2 */
+
+
+#if defined(SIMD_SSSE3)
+/*
+ * The code points of the 4 3 byte sequences at @in, 32 bits each, and
+ * in @leads whether each starts with a 3 byte lead. 16 bytes are read.
+ */
+static __m128i
+decodeUtf8Triples(const unsigned char* in, int* leads) {
+
+    /* trail | mid << 8 | lead << 16 */
+    __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) in),
+                                 _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1));
+
+    *leads = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(x, _mm_set1_epi32(0xF00000)),
+                                               _mm_set1_epi32(0xE00000))) == 0xFFFF;
+    return _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(x, 4), _mm_set1_epi32(0xF000)),
+                                     _mm_and_si128(_mm_srli_epi32(x, 2), _mm_set1_epi32(0x0FC0))),
+                        _mm_and_si128(x, _mm_set1_epi32(0x3F)));
+}
+#endif /* SIMD_SSSE3 */
+
+
+/* the characters below these that encodeUnits() and decodeUtf8() may take, by code point and lead byte */
+#if defined(SIMD_SSSE3)
+#define VECTOR_UTF8_LIMIT 0x10000
+#define VECTOR_UTF8_LEAD_LIMIT 0xF0
+#elif defined(SIMD_SSE2)
+#define VECTOR_UTF8_LIMIT 0x800
+#define VECTOR_UTF8_LEAD_LIMIT 0xE0
+#else
+#define VECTOR_UTF8_LIMIT 0x80
+#define VECTOR_UTF8_LEAD_LIMIT 0x80
+#endif
+
+
+/**
+ * encodeUnits:
+ * @out:  where to store the UTF-8
+ * @outlen:  the room at @out, set to the number of bytes stored
+ * @in:  UTF-16 or UTF-32 code units
+ * @units:  the number of code units at @in
+ * @form:  the form of @in
+ *
+ * Encode the characters at the start of @in as UTF-8, 8 code units at a
+ * time while they are all of 2 byte sequences (U+0080 - U+07FF, the
+ * alphabets of Europe and the Middle East) or, with SSSE3, all of 3 byte
+ * ones (the rest of the BMP but the surrogates, CJK among them). A block
+ * that mixes lengths is left to the caller.
+ * Returns the number of code units encoded.
+ */
+static int
+encodeUnits(unsigned char* out, int* outlen, const unsigned char* in, int units,
+            encodingUnicodeForm form) {
+
+    int n = 0;
+    int len = 0;
+
+#if defined(SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i above7FF = _mm_set1_epi16((short) 0xF800);
+    const int unit = UNIT_SIZE(form);
+
+    while (units - n >= 8) {
+        __m128i u;
+        unsigned int below800;
+        if (!loadUnits(in + n * unit, form, &u)) {
+            break;
+        }
+        below800 = (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(u, above7FF), zero));
+        if (below800 == 0xFFFF && *outlen - len >= 16 &&
+            _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16((short) 0xFF80)), zero)) == 0) {
+            /* lead | trail << 8 */
+            _mm_storeu_si128((__m128i*) (out + len),
+                _mm_or_si128(_mm_or_si128(_mm_srli_epi16(u, 6),
+                                          _mm_slli_epi16(_mm_and_si128(u, _mm_set1_epi16(0x3F)), 8)),
+                             _mm_set1_epi16((short) 0x80C0)));
+            len += 16;
+#if defined(SIMD_SSSE3)
+        } else if (below800 == 0 && *outlen - len >= 24 &&
+                   _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(u, above7FF),
+                                                     _mm_set1_epi16((short) 0xD800))) == 0) {
+            __m128i leadMid = _mm_or_si128(
+                _mm_or_si128(_mm_srli_epi16(u, 12),
+                             _mm_slli_epi16(_mm_and_si128(_mm_srli_epi16(u, 6), _mm_set1_epi16(0x3F)), 8)),
+                _mm_set1_epi16((short) 0x80E0));
+            __m128i trail = _mm_or_si128(_mm_and_si128(u, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+            trail = _mm_packus_epi16(trail, trail);
+            _mm_storeu_si128((__m128i*) (out + len), _mm_or_si128(
+                _mm_shuffle_epi8(leadMid, _mm_setr_epi8(0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, 8, 9, -1, 10)),
+                _mm_shuffle_epi8(trail, _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1))));
+            _mm_storel_epi64((__m128i*) (out + len + 16), _mm_or_si128(
+                _mm_shuffle_epi8(leadMid, _mm_setr_epi8(11, -1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+                _mm_shuffle_epi8(trail, _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1))));
+            len += 24;
+#endif
+        } else {
+            break;
+        }
+        n += 8;
+    }
+#else
+    (void) out;
+    (void) in;
+    (void) units;
+    (void) form;
+#endif
+    *outlen = len;
+    return n;
+}
+
+
+/**
+ * decodeUtf8:
+ * @out:  where to store the code units
+ * @outlen:  the room at @out, set to the number of bytes stored
+ * @in:  well-formed UTF-8, starting at a character
+ * @len:  the length of @in
+ * @form:  the form of @out
+ *
+ * encodeUnits() the other way round: decode the characters at the start
+ * of @in, 8 at a time while they are all 2 byte sequences or, with
+ * SSSE3, all 3 byte ones.
+ * Returns the number of bytes decoded.
+ */
+static int
+decodeUtf8(unsigned char* out, int* outlen, const unsigned char* in, int len,
+           encodingUnicodeForm form) {
+
+    int n = 0;
+    int produced = 0;
+
+#if defined(SIMD_SSE2)
+    const int block = 8 * UNIT_SIZE(form);
+
+    while (*outlen - produced >= block) {
+        if (len - n >= 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*) (in + n));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short) 0xC0E0)),
+                                                  _mm_set1_epi16((short) 0x80C0))) == 0xFFFF) {
+                /* 8 leads of 2 byte sequences, each followed by its trailing byte */
+                storeUnits(out + produced,
+                           _mm_or_si128(_mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1F)), 6),
+                                        _mm_and_si128(_mm_srli_epi16(v, 8), _mm_set1_epi16(0x3F))),
+                           form);
+                n += 16;
+                produced += block;
+                continue;
+            }
+        }
+#if defined(SIMD_SSSE3)
+        if (len - n >= 28) {
+            int leadsA;
+            int leadsB;
+            __m128i a = decodeUtf8Triples(in + n, &leadsA);
+            __m128i b = decodeUtf8Triples(in + n + 12, &leadsB);
+            if (leadsA && leadsB) {
+                storeUnits(out + produced,
+                           _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16),
+                                           _mm_srai_epi32(_mm_slli_epi32(b, 16), 16)),
+                           form);
+                n += 24;
+                produced += block;
+                continue;
+            }
+        }
+#endif
+        break;
+    }
+#else
+    (void) out;
+    (void) in;
+    (void) len;
+    (void) form;
+#endif
+    *outlen = produced;
+    return n;
+}
+
+
+/**
+ * readUnicode:
+ * @in:  UTF-16 or UTF-32 code units
+ * @len:  the length of @in in bytes
+ * @form:  the form of @in
+ * @c:  set to the code point
+ *
+ * Decode the character at the start of @in: a code unit, or a pair of
+ * UTF-16 surrogates.
+ * Returns its length in bytes, 0 if @in ends within it, or -1 for an
+ * unpaired surrogate or a UTF-32 unit that is no code point.
+ */
+static int
+readUnicode(const unsigned char* in, int len, encodingUnicodeForm form, unsigned int* c) {
+
+    unsigned int low;
+
+    switch (form) {
+        case encodingUTF16LE:
+        case encodingUTF16BE:
+            if (len < 2) {
+                return 0;
+            }
+            *c = (form == encodingUTF16LE) ? in[0] | in[1] << 8 : in[0] << 8 | in[1];
+            if (*c - 0xD800 >= 0x800) {
+                return 2;
+            }
+            if (*c >= 0xDC00) {
+                /* low surrogate first */
+                return -1;
+            }
+            if (len < 4) {
+                return 0;
+            }
+            low = (form == encodingUTF16LE) ? in[2] | in[3] << 8 : in[2] << 8 | in[3];
+            if (low - 0xDC00 >= 0x400) {
+                /* high surrogate not followed by a low one */
+                return -1;
+            }
+            *c = 0x10000 + ((*c - 0xD800) << 10) + (low - 0xDC00);
+            return 4;
+        default:
+            if (len < 4) {
+                return 0;
+            }
+            *c = (form == encodingUTF32LE)
+                 ? (unsigned int) in[0] | in[1] << 8 | in[2] << 16 | (unsigned int) in[3] << 24
+                 : (unsigned int) in[0] << 24 | in[1] << 16 | in[2] << 8 | in[3];
+            return (*c > 0x10FFFF || *c - 0xD800 < 0x800) ? -1 : 4;
+    }
+}
+
+
+/**
+ * writeUnicode:
+ * @out:  where to store the code units, with room for 4 bytes
+ * @c:  a code point, not a surrogate
+ * @form:  the form of @out
+ *
+ * Returns the number of bytes stored.
+ */
+static int
+writeUnicode(unsigned char* out, unsigned int c, encodingUnicodeForm form) {
+
+    switch (form) {
+        case encodingUTF16LE:
+        case encodingUTF16BE:
+            if (c >= 0x10000) {
+                unsigned int high = 0xD800 + ((c - 0x10000) >> 10);
+                writeUnicode(out, high, form);
+                writeUnicode(out + 2, 0xDC00 + (c & 0x3FF), form);
+                return 4;
+            }
+            out[form == encodingUTF16BE] = (unsigned char) c;
+            out[form == encodingUTF16LE] = (unsigned char) (c >> 8);
+            return 2;
+        case encodingUTF32LE:
+            out[0] = (unsigned char) c;
+            out[1] = (unsigned char) (c >> 8);
+            out[2] = (unsigned char) (c >> 16);
+            out[3] = 0;
+            return 4;
+        default:
+            out[0] = 0;
+            out[1] = (unsigned char) (c >> 16);
+            out[2] = (unsigned char) (c >> 8);
+            out[3] = (unsigned char) c;
+            return 4;
+    }
+}
+
+
+/* number of UTF-8 bytes of code point @c */
+#define UTF8_LENGTH(c) ((c) < 0x80 ? 1 : (c) < 0x800 ? 2 : (c) < 0x10000 ? 3 : 4)
+
+
+/**
+ * unicodeToUTF8:
+ * @out:  a pointer to an array of bytes to store the result
+ * @outlen:  the length of @out
+ * @in:  a pointer to an array of UTF-16 or UTF-32 code units
+ * @inlen:  the length of @in in bytes
+ * @context:  the unicodeContext with the form of @in
+ *
+ * Take a block of UTF-16 or UTF-32 chars in and try to convert it to an
+ * UTF-8 block of chars out. Runs of US-ASCII are narrowed 16 code units
+ * at a time, and runs of 2 or 3 byte characters encoded 8 at a time by
+ * encodeUnits(); mixed text and characters above U+FFFF take the scalar
+ * path.
+ * Returns 0 if success, -2 for an unpaired surrogate or a UTF-32 unit
+ * that is no code point, or -1 otherwise
+ * The value of @inlen after return is the number of octets consumed,
+ *     without a character that @in ends within
+ * The value of @outlen after return is the number of octets produced.
+ */
+static int
+unicodeToUTF8(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const void* context) {
+
+    encodingUnicodeForm form = ((const unicodeContext*) context)->form;
+    const int unit = UNIT_SIZE(form);
+    unsigned char* outstart = out;
+    unsigned char* outend = out + *outlen;
+    const unsigned char* instart = in;
+    const unsigned char* inend = in + *inlen;
+    int scalar = 0;   /* characters to convert before trying encodeUnits() again */
+    int rc = 0;
+
+    while (in < inend) {
+        unsigned int c;
+        int length = readUnicode(in, inend - in, form, &c);
+        if (length <= 0) {
+            rc = (length < 0) ? -2 : 0;
+            break;
+        }
+        if (c < 0x80) {
+            int units = ((inend - in) / unit < outend - out) ? (inend - in) / unit : outend - out;
+            int ascii = narrowUnits(out, in, units, form, 0x80);
+            if (ascii > 0) {
+                in += ascii * unit;
+                out += ascii;
+                continue;
+            }
+        } else if (c < VECTOR_UTF8_LIMIT && --scalar < 0) {
+            int len = outend - out;
+            int units = encodeUnits(out, &len, in, (inend - in) / unit, form);
+            if (units > 0) {
+                in += units * unit;
+                out += len;
+                continue;
+            }
+            /* a mix, give the vectors another go some characters on */
+            scalar = 8;
+        }
+        if (outend - out < UTF8_LENGTH(c)) {
+            break;
+        }
+        if (c < 0x80) {
+            *out++ = (unsigned char) c;
+        } else if (c < 0x800) {
+            *out++ = ((c >>  6) & 0x1F) | 0xC0;
+            *out++ = (c & 0x3F) | 0x80;
+        } else if (c < 0x10000) {
+            *out++ = ((c >>  12) & 0x0F) | 0xE0;
+            *out++ = ((c >>  6) & 0x3F) | 0x80;
+            *out++ = (c & 0x3F) | 0x80;
+        } else {
+            *out++ = ((c >>  18) & 0x07) | 0xF0;
+            *out++ = ((c >>  12) & 0x3F) | 0x80;
+            *out++ = ((c >>  6) & 0x3F) | 0x80;
+            *out++ = (c & 0x3F) | 0x80;
+        }
+        in += length;
+    }
+    *outlen = out - outstart;
+    *inlen = in - instart;
+    return rc;
+}
+
 
-    /* Count bytes in 'in' */
-    byteLenIn = strlen((const char*) in);
-
-    if (byteLenIn > 0) {
-        if (getISOLatin1ToUtf8_RequiredLength(in, &byteLenIn, &byteLenOut, &needToTranscode) == 0) {
-            if (needToTranscode) {
-                szLenOut = byteLenOut + 1;
-                *out = malloc(szLenOut * sizeof(unsigned char));
-                if (isolat1ToUTF8(*out, &byteLenOut, in, &byteLenIn) == 0) {
-                    /* transcoding succeeded, zero-terminate *out */
-                    (*out)[byteLenOut] = '\0';
-                    *wasTranscoded = 1;
-                } else {
-                    /* transcoding didn't succeed */
-                    free(*out);
-                    *wasTranscoded = 0;
-                    return -1;
+/**
+ * UTF8ToUnicode:
+ * @out:  a pointer to an array of bytes to store the result
+ * @outlen:  the length of @out
+ * @in:  a pointer to an array of UTF-8 chars
+ * @inlen:  the length of @in
+ * @context:  the unicodeContext with the form of @out
+ *
+ * Take a block of UTF-8 chars in and try to convert it to a UTF-16 or
+ * UTF-32 block of chars out. Runs of US-ASCII are widened 16 bytes at a
+ * time, and runs of 2 or 3 byte sequences decoded 8 at a time by
+ * decodeUtf8(); mixed text and 4 byte sequences take the scalar path.
+ * Returns 0 if success, -2 if the transcoding fails, or -1 otherwise
+ * The value of @inlen after return is the number of octets consumed
+ *     as the return value is positive, else unpredictable.
+ * The value of @outlen after return is the number of octets produced.
+ */
+static int
+UTF8ToUnicode(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const void* context) {
+
+    encodingUnicodeForm form = ((const unicodeContext*) context)->form;
+    const int unit = UNIT_SIZE(form);
+    unsigned char* outstart = out;
+    unsigned char* outend = out + *outlen;
+    const unsigned char* instart = in;
+    const unsigned char* inend;
+    int scalar = 0;   /* characters to convert before trying decodeUtf8() again */
+    int malformed;
+
+    /* the well-formed prefix, decoded below without further checks */
+    inend = in + validUtf8(in, *inlen, *outlen / unit, &malformed);
+    while (in < inend) {
+        unsigned int c = *in;
+        int length;
+        if (c < 0x80) {
+            int len = (inend - in < (outend - out) / unit) ? inend - in : (outend - out) / unit;
+            int ascii = widenBytes(out, in, len, form, 1);
+            if (ascii > 0) {
+                in += ascii;
+                out += ascii * unit;
+                continue;
+            }
+            length = 1;
+        } else {
+            if (c < VECTOR_UTF8_LEAD_LIMIT && --scalar < 0) {
+                int len = outend - out;
+                int decoded = decodeUtf8(out, &len, in, inend - in, form);
+                if (decoded > 0) {
+                    in += decoded;
+                    out += len;
+                    continue;
                 }
+                /* a mix, give the vectors another go some characters on */
+                scalar = 8;
+            }
+            if (c < 0xE0) {
+                c = (c & 0x1F) << 6 | (in[1] & 0x3F);
+                length = 2;
+            } else if (c < 0xF0) {
+                c = (c & 0x0F) << 12 | (in[1] & 0x3F) << 6 | (in[2] & 0x3F);
+                length = 3;
             } else {
-                /* 'in' contains only US-ASCII encoded characters and is zero-terminated by assumption */
-                /* Note: Simply assigning the 'in' pointer assumes that 'in' doesn't get free'd afterwards !!! */
-                *out = (unsigned char*) in;
-                *wasTranscoded = 0;
+                c = (c & 0x07) << 18 | (in[1] & 0x3F) << 12 | (in[2] & 0x3F) << 6 | (in[3] & 0x3F);
+                length = 4;
+            }
+        }
+        if (outend - out < ((c >= 0x10000) ? 4 : unit)) {
+            break;
+        }
+        out += writeUnicode(out, c, form);
+        in += length;
+    }
+    *outlen = out - outstart;
+    if (in == inend && inend < instart + *inlen) {
+        /*
+         * an ill-formed or, at the end of the input, incomplete character:
+         * a prefix cut short by the look-ahead would have filled @out
+         */
+        *inlen = in - instart;
+        return -2;
+    }
+    *inlen = in - instart;
+    return 0;
+}
+
+
+/**
+ * unicodeToSingleByte:
+ * @out:  a pointer to an array of bytes to store the result
+ * @outlen:  the length of @out
+ * @in:  a pointer to an array of UTF-16 or UTF-32 code units
+ * @inlen:  the length of @in in bytes
+ * @context:  the unicodeContext with the form of @in and the codepage
+ *
+ * Take a block of UTF-16 or UTF-32 chars in and try to convert it to a
+ * block of Latin-1 chars, or of chars in a single byte codepage, out.
+ * Runs of code units that are their own bytes (all below 0x100 for
+ * Latin-1, US-ASCII otherwise) are narrowed 16 at a time. As with
+ * UTF8Toisolat1(), an inverted question mark is substituted for
+ * characters not in Latin-1; characters not in a codepage fail the
+ * transcoding unless it has a substitute.
+ * Returns 0 if success, -2 if the transcoding fails, or -1 otherwise
+ * The value of @inlen after return is the number of octets consumed,
+ *     without a character that @in ends within
+ * The value of @outlen after return is the number of octets produced.
+ */
+static int
+unicodeToSingleByte(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const void* context) {
+
+    encodingUnicodeForm form = ((const unicodeContext*) context)->form;
+    const encodingCodepage* codepage = ((const unicodeContext*) context)->codepage;
+    const unsigned int limit = (codepage == NULL) ? 0x100 : 0x80;
+    const int unit = UNIT_SIZE(form);
+    unsigned char* outstart = out;
+    unsigned char* outend = out + *outlen;
+    const unsigned char* instart = in;
+    const unsigned char* inend = in + *inlen;
+    int rc = 0;
+
+    while (in < inend && out < outend) {
+        unsigned int c;
+        int length = readUnicode(in, inend - in, form, &c);
+        if (length <= 0) {
+            rc = (length < 0) ? -2 : 0;
+            break;
+        }
+        if (c < limit) {
+            int units = ((inend - in) / unit < outend - out) ? (inend - in) / unit : outend - out;
+            int same = narrowUnits(out, in, units, form, limit);
+            if (same > 0) {
+                in += same * unit;
+                out += same;
+                continue;
             }
         } else {
-            /* length determination didn't succeed */
-            *wasTranscoded = 0;
-            return -1;
+            unsigned char const* xlattable = (codepage != NULL) ? codepage->fromUnicode : NULL;
+            if (xlattable == NULL || c >= 0x10000) {
+                c = 0;
+            } else if (c < 0x800) {
+                c = xlattable [48 + (c & 0x3F) + xlattable [c >> 6] * 64];
+            } else {
+                c = xlattable [48 + (c & 0x3F) +
+                               xlattable [48 + ((c >> 6) & 0x3F) + xlattable [32 + (c >> 12)] * 64] * 64];
+            }
+            if (c == 0) {
+                /* not in character set */
+                c = (codepage != NULL) ? codepage->substitute : 0xBF;
+                if (c == 0) {
+                    rc = -2;
+                    break;
+                }
+            }
         }
-    } else {
-        /* in is an empty string */
-        *out = malloc(1 * sizeof(unsigned char));
-        *out = '\0';
-        *wasTranscoded = 1;
+        *out++ = (unsigned char) c;
+        in += length;
     }
+    *outlen = out - outstart;
+    *inlen = in - instart;
+    return rc;
+}
 
-    return 0;
+
+/**
+ * singleByteToUnicode:
+ * @out:  a pointer to an array of bytes to store the result
+ * @outlen:  the length of @out
+ * @in:  a pointer to an array of Latin-1 chars, or chars in a codepage
+ * @inlen:  the length of @in
+ * @context:  the unicodeContext with the form of @out and the codepage
+ *
+ * Take a block of Latin-1 chars, or of chars in a single byte codepage,
+ * in and convert it to a UTF-16 or UTF-32 block of chars out. Latin-1,
+ * and US-ASCII in any codepage, is widened 16 bytes at a time.
+ * Returns 0 if success, -2 if @in holds a byte undefined in the
+ * codepage, or -1 otherwise
+ * The value of @inlen after return is the number of octets consumed
+ * The value of @outlen after return is the number of octets produced.
+ */
+static int
+singleByteToUnicode(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const void* context) {
+
+    encodingUnicodeForm form = ((const unicodeContext*) context)->form;
+    const encodingCodepage* codepage = ((const unicodeContext*) context)->codepage;
+    const int unit = UNIT_SIZE(form);
+    unsigned char* outstart = out;
+    unsigned char* outend = out + *outlen;
+    const unsigned char* instart = in;
+    const unsigned char* inend = in + *inlen;
+    int rc = 0;
+
+    while (in < inend && outend - out >= unit) {
+        unsigned int c = *in;
+        if (c < 0x80 || codepage == NULL) {
+            int len = (inend - in < (outend - out) / unit) ? inend - in : (outend - out) / unit;
+            int same = widenBytes(out, in, len, form, codepage != NULL);
+            if (same > 0) {
+                in += same;
+                out += same * unit;
+                continue;
+            }
+        } else {
+            c = codepage->toUnicode [c - 0x80];
+            if (c == 0) {
+                /* undefined code point */
+                rc = -2;
+                break;
+            }
+        }
+        out += writeUnicode(out, c, form);
+        ++in;
+    }
+    *outlen = out - outstart;
+    *inlen = in - instart;
+    return rc;
 }
 
-/*
- * (SPZ) TODO: utf8ToLatin1() and latin1ToUtf8() could be collapsed
- * into one function using function pointers for the applied conversion
- * and length functions (same for Latin-9 variants - all 4 could be one
- * function).
+
+/**
+ * cutUtf16LE:
+ * @in:  a pointer to UTF-16LE code units
+ * @len:  the length of @in in bytes, even
+ *
+ * Returns @len less the last code unit of @in if that is a high
+ * surrogate, so that a chunk of UTF-16 ending there is not cut within a
+ * pair.
+ */
+static int
+cutUtf16LE(const unsigned char* in, int len) {
+
+    return ((in[len - 1] & 0xFC) == 0xD8) ? len - 2 : len;
+}
+
+
+/* cutUtf16LE() for UTF-16BE */
+static int
+cutUtf16BE(const unsigned char* in, int len) {
+
+    return ((in[len - 2] & 0xFC) == 0xD8) ? len - 2 : len;
+}
+
+
+/* the cut for convertBuffer() of @in in @form, UTF-32 units are never paired */
+#define CUT_UNICODE(form) \
+    (((form) == encodingUTF16LE) ? cutUtf16LE : ((form) == encodingUTF16BE) ? cutUtf16BE : NULL)
+
+
+/**
+ * unicodeBuffer:
+ *
+ * convertBuffer() with the unicodeContext of @form and @codepage.
  */
+static int
+unicodeBuffer(const unsigned char* in, size_t inlen, unsigned char* out, size_t outsize, size_t* outlen,
+              blockConverter convert, encodingUnicodeForm form, const encodingCodepage* codepage,
+              int (*cut)(const unsigned char* in, int len), int growth) {
+
+    unicodeContext context;
+
+    if ((unsigned int) form > encodingUTF32BE) {
+        return -1;
+    }
+    context.form = form;
+    context.codepage = codepage;
+    return convertBuffer(in, inlen, out, outsize, outlen, convert, &context, cut, growth);
+}
+
+
+int unicodeToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form) {
+
+    /* 3 bytes for 2 of UTF-16 at most */
+    return unicodeBuffer(in, inlen, out, outsize, outlen, unicodeToUTF8, form, NULL,
+                         CUT_UNICODE(form), 2);
+}
+
+
+int utf8ToUnicodeBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form) {
+
+    return unicodeBuffer(in, inlen, out, outsize, outlen, UTF8ToUnicode, form, NULL,
+                         cutUtf8, UNIT_SIZE(form));
+}
+
+
+int unicodeToLatin1Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form) {
+
+    return unicodeBuffer(in, inlen, out, outsize, outlen, unicodeToSingleByte, form, NULL,
+                         CUT_UNICODE(form), 1);
+}
+
+
+int latin1ToUnicodeBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form) {
+
+    return unicodeBuffer(in, inlen, out, outsize, outlen, singleByteToUnicode, form, NULL,
+                         NULL, UNIT_SIZE(form));
+}
+
+
+int unicodeToCodepageBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form,
+    const encodingCodepage* codepage) {
+
+    if (codepage == NULL) {
+        return -1;
+    }
+    return unicodeBuffer(in, inlen, out, outsize, outlen, unicodeToSingleByte, form, codepage,
+                         CUT_UNICODE(form), 1);
+}
+
+
+int codepageToUnicodeBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form,
+    const encodingCodepage* codepage) {
+
+    if (codepage == NULL) {
+        return -1;
+    }
+    return unicodeBuffer(in, inlen, out, outsize, outlen, singleByteToUnicode, form, codepage,
+                         NULL, UNIT_SIZE(form));
+}
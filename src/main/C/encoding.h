@@ -18,6 +18,7 @@
 #ifndef __CHAR_ENCODING_UTF8_H__
 #define __CHAR_ENCODING_UTF8_H__
 
+#include <stddef.h> /* size_t */
 
 
 #ifdef __cplusplus
@@ -26,6 +27,74 @@ extern "C" {
 
 
 
+/**
+ * Where the string functions allocate their results. reallocate() is
+ * told the old size, and release() may be a no-op for allocators that
+ * free everything at once.
+ */
+typedef struct {
+    void* (*allocate)(void* context, size_t size);
+    void* (*reallocate)(void* context, void* ptr, size_t oldSize, size_t size);
+    void (*release)(void* context, void* ptr);
+    void* context;
+} encodingAllocator;
+
+
+/**
+ * A bump allocator: the results of a request's conversions are carved
+ * one after the other out of large blocks and all given back at once by
+ * encodingArenaReset(). Only the latest allocation can grow in place or
+ * be released early. An arena is not thread-safe; use one per thread or
+ * request.
+ *
+ * Pass &arena->allocator to the *Alloc() functions.
+ */
+typedef struct {
+    struct encodingArenaBlock* head;
+    size_t blockSize;
+    encodingAllocator allocator;
+} encodingArena;
+
+
+/**
+ * Set up an empty arena; nothing is allocated until it is used. Blocks
+ * are 'blockSize' bytes (0 for 64 KiB), or larger for larger strings.
+ */
+void encodingArenaInit(encodingArena* arena, size_t blockSize);
+
+
+/**
+ * Invalidate everything allocated from 'arena' and make it available
+ * again. An arena that needed more than one block frees them and uses a
+ * single block of their total size from then on.
+ */
+void encodingArenaReset(encodingArena* arena);
+
+
+/**
+ * Free all memory of 'arena'; it may be used again after another
+ * encodingArenaInit().
+ */
+void encodingArenaFree(encodingArena* arena);
+
+
+/**
+ * utf8Validate:
+ * @in:  a pointer to an array of bytes
+ * @len:  the length of @in
+ * @errorOffset:  set to the offset of the first ill-formed sequence, may be NULL
+ *
+ * Check that @in is well-formed UTF-8: no stray trailing bytes, overlong
+ * forms, surrogates, code points above U+10FFFF or truncated characters.
+ * Works on 16 or 32 bytes at a time where SSSE3 or AVX2 is available.
+ * The functions converting from UTF-8 use the same check and fail the
+ * transcoding on anything it rejects.
+ *
+ * Returns 0 if @in is well-formed, or -1 otherwise.
+ */
+int utf8Validate(const unsigned char* in, size_t len, size_t* errorOffset);
+
+
 /**
  * Attempt to convert UTF-8 encoded 'in' to Latin-1 encoded *out.
  * Correctly sized memory for *out will be malloc'ed automatically
@@ -48,6 +117,34 @@ extern "C" {
 int utf8ToLatin1(const unsigned char* in, unsigned char** out, int* wasTranscoded);
 
 
+/**
+ * utf8ToLatin1() with *out taken from 'allocator' rather than malloc'ed (NULL
+ * selects malloc). If 'wasTranscoded' == 1, *out is to be given back
+ * with allocator->release(), or with the arena it came from.
+ */
+int utf8ToLatin1Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingAllocator* allocator);
+
+
+/**
+ * Convert the UTF-8 encoded 'inlen' bytes at 'in' to Latin-1 in the
+ * caller's buffer 'out' of 'outsize' bytes. Nothing is allocated and 'in'
+ * need not be zero-terminated; zero bytes are converted like any other
+ * US-ASCII character, and no terminator is appended to 'out'.
+ *
+ * On return *outlen holds the length of the result. Calling it with
+ * out == NULL and outsize == 0 just measures it; outsize == inlen is
+ * always enough.
+ *
+ * Returns rc == 0 on success, rc == -3 if 'out' is too small (*outlen is
+ * then the size needed, and 'out' holds what fitted), rc == -2 if 'in'
+ * cannot be transcoded (malformed or truncated UTF-8), or rc == -1 on
+ * invalid arguments.
+ */
+int utf8ToLatin1Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen);
+
+
 /**
  * Attempt to convert Latin-1 encoded 'in' to UTF-8 encoded *out.
  * Correctly sized memory for *out will be malloc'ed automatically
@@ -70,6 +167,34 @@ int utf8ToLatin1(const unsigned char* in, unsigned char** out, int* wasTranscode
 int latin1ToUtf8(const unsigned char* in, unsigned char** out, int* wasTranscoded);
 
 
+/**
+ * latin1ToUtf8() with *out taken from 'allocator' rather than malloc'ed (NULL
+ * selects malloc). If 'wasTranscoded' == 1, *out is to be given back
+ * with allocator->release(), or with the arena it came from.
+ */
+int latin1ToUtf8Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingAllocator* allocator);
+
+
+/**
+ * Convert the Latin-1 encoded 'inlen' bytes at 'in' to UTF-8 in the
+ * caller's buffer 'out' of 'outsize' bytes. Nothing is allocated and 'in'
+ * need not be zero-terminated; zero bytes are converted like any other
+ * US-ASCII character, and no terminator is appended to 'out'.
+ *
+ * On return *outlen holds the length of the result. Calling it with
+ * out == NULL and outsize == 0 just measures it; outsize == 2 * inlen is
+ * always enough.
+ *
+ * Returns rc == 0 on success, rc == -3 if 'out' is too small (*outlen is
+ * then the size needed, and 'out' holds what fitted), rc == -2 if 'in'
+ * cannot be transcoded (not for Latin-1), or rc == -1 on invalid
+ * arguments.
+ */
+int latin1ToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen);
+
+
 /**
  * Attempt to convert UTF-8 encoded 'in' to Latin-9 encoded *out.
  * Correctly sized memory for *out will be malloc'ed automatically
@@ -92,6 +217,34 @@ int latin1ToUtf8(const unsigned char* in, unsigned char** out, int* wasTranscode
 int utf8ToLatin9(const unsigned char* in, unsigned char** out, int* wasTranscoded);
 
 
+/**
+ * utf8ToLatin9() with *out taken from 'allocator' rather than malloc'ed (NULL
+ * selects malloc). If 'wasTranscoded' == 1, *out is to be given back
+ * with allocator->release(), or with the arena it came from.
+ */
+int utf8ToLatin9Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingAllocator* allocator);
+
+
+/**
+ * Convert the UTF-8 encoded 'inlen' bytes at 'in' to Latin-9 in the
+ * caller's buffer 'out' of 'outsize' bytes. Nothing is allocated and 'in'
+ * need not be zero-terminated; zero bytes are converted like any other
+ * US-ASCII character, and no terminator is appended to 'out'.
+ *
+ * On return *outlen holds the length of the result. Calling it with
+ * out == NULL and outsize == 0 just measures it; outsize == inlen is
+ * always enough.
+ *
+ * Returns rc == 0 on success, rc == -3 if 'out' is too small (*outlen is
+ * then the size needed, and 'out' holds what fitted), rc == -2 if 'in'
+ * cannot be transcoded (malformed or truncated UTF-8, or a character not
+ * in Latin-9), or rc == -1 on invalid arguments.
+ */
+int utf8ToLatin9Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen);
+
+
 /**
  * Attempt to convert Latin-9 encoded 'in' to UTF-8 encoded *out.
  * Correctly sized memory for *out will be malloc'ed automatically
@@ -114,6 +267,153 @@ int utf8ToLatin9(const unsigned char* in, unsigned char** out, int* wasTranscode
 int latin9ToUtf8(const unsigned char* in, unsigned char** out, int* wasTranscoded);
 
 
+/**
+ * latin9ToUtf8() with *out taken from 'allocator' rather than malloc'ed (NULL
+ * selects malloc). If 'wasTranscoded' == 1, *out is to be given back
+ * with allocator->release(), or with the arena it came from.
+ */
+int latin9ToUtf8Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingAllocator* allocator);
+
+
+/**
+ * Convert the Latin-9 encoded 'inlen' bytes at 'in' to UTF-8 in the
+ * caller's buffer 'out' of 'outsize' bytes. Nothing is allocated and 'in'
+ * need not be zero-terminated; zero bytes are converted like any other
+ * US-ASCII character, and no terminator is appended to 'out'.
+ *
+ * On return *outlen holds the length of the result. Calling it with
+ * out == NULL and outsize == 0 just measures it; outsize == 3 * inlen is
+ * always enough.
+ *
+ * Returns rc == 0 on success, rc == -3 if 'out' is too small (*outlen is
+ * then the size needed, and 'out' holds what fitted), rc == -2 if 'in'
+ * cannot be transcoded (a byte undefined in Latin-9), or rc == -1 on
+ * invalid arguments.
+ */
+int latin9ToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen);
+
+
+/**
+ * A single byte codepage that agrees with US-ASCII below 0x80. The
+ * tables are generated into codepages.h by gencodepages.py; converting
+ * to and from any of them is the same code, with the same US-ASCII fast
+ * path.
+ */
+typedef struct {
+    const char* name;                   /* IANA name, e.g. "ISO-8859-2" */
+    unsigned short const* toUnicode;    /* code points of 0x80 - 0xFF, 0 where undefined */
+    unsigned char const* toUtf8;        /* the same as UTF-8, 4 bytes each: the sequence, then its length */
+    unsigned char const* fromUnicode;   /* two-level table from UTF-8 */
+    unsigned char substitute;           /* for characters not in the codepage, 0 to fail instead */
+} encodingCodepage;
+
+extern const encodingCodepage encodingISO8859_2;    /* Latin-2 */
+extern const encodingCodepage encodingISO8859_5;    /* Cyrillic */
+extern const encodingCodepage encodingISO8859_7;    /* Greek */
+extern const encodingCodepage encodingISO8859_15;   /* Latin-9 */
+extern const encodingCodepage encodingCp1250;       /* Windows Central European */
+extern const encodingCodepage encodingCp1251;       /* Windows Cyrillic */
+extern const encodingCodepage encodingCp1253;       /* Windows Greek */
+extern const encodingCodepage encodingCp1252;       /* Windows Western European, substitutes 0xBF */
+
+
+/**
+ * utf8ToLatin9() for any of the codepages above; utf8ToLatin9() is
+ * utf8ToCodepage() with &encodingISO8859_15. Returns rc == -1 as well if
+ * 'in' holds a character not in 'codepage', unless 'codepage' has a
+ * substitute for it.
+ */
+int utf8ToCodepage(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingCodepage* codepage);
+
+
+/**
+ * utf8ToCodepage() with *out taken from 'allocator' rather than malloc'ed
+ * (NULL selects malloc), as utf8ToLatin9Alloc().
+ */
+int utf8ToCodepageAlloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingCodepage* codepage, const encodingAllocator* allocator);
+
+
+/**
+ * utf8ToLatin9Buffer() for any of the codepages above: outsize == inlen
+ * is always enough, and rc == -2 is returned for malformed or truncated
+ * UTF-8 or a character not in 'codepage' that has no substitute.
+ */
+int utf8ToCodepageBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen,
+    const encodingCodepage* codepage);
+
+
+/**
+ * latin9ToUtf8() for any of the codepages above. Returns rc == -1 as
+ * well if 'in' holds a byte undefined in 'codepage'.
+ */
+int codepageToUtf8(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingCodepage* codepage);
+
+
+/**
+ * codepageToUtf8() with *out taken from 'allocator' rather than malloc'ed
+ * (NULL selects malloc), as latin9ToUtf8Alloc().
+ */
+int codepageToUtf8Alloc(const unsigned char* in, unsigned char** out, int* wasTranscoded,
+    const encodingCodepage* codepage, const encodingAllocator* allocator);
+
+
+/**
+ * latin9ToUtf8Buffer() for any of the codepages above: outsize == 3 * inlen
+ * is always enough, and rc == -2 is returned for a byte undefined in
+ * 'codepage'.
+ */
+int codepageToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen,
+    const encodingCodepage* codepage);
+
+
+/**
+ * singleByteToUTF8:
+ * @out:  a pointer to an array of bytes to store the result
+ * @outlen:  the length of @out
+ * @in:  a pointer to an array of chars in @codepage
+ * @inlen:  the length of @in
+ * @codepage:  the codepage of @in
+ *
+ * Take a block of chars in a single byte codepage and try to convert it
+ * to an UTF-8 block of chars out.
+ * Returns 0 if success, -2 if @in holds a byte undefined in @codepage,
+ * or -1 otherwise
+ * The value of @inlen after return is the number of octets consumed
+ * The value of @outlen after return is the number of octets produced.
+ */
+int singleByteToUTF8(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const encodingCodepage* codepage);
+
+
+/**
+ * UTF8ToSingleByte:
+ * @out:  a pointer to an array of bytes to store the result
+ * @outlen:  the length of @out
+ * @in:  a pointer to an array of UTF-8 chars
+ * @inlen:  the length of @in
+ * @codepage:  the codepage to convert to
+ *
+ * Take a block of UTF-8 chars in and try to convert it to a block of
+ * chars in a single byte codepage out. As with UTF8Toisolat1(), a
+ * character that @in ends within is not consumed and left for the next
+ * block.
+ *
+ * Returns 0 if success, -2 if the transcoding fails, or -1 otherwise
+ * The value of @inlen after return is the number of octets consumed
+ *     as the return value is positive, else unpredictable.
+ * The value of @outlen after return is the number of octets produced.
+ */
+int UTF8ToSingleByte(unsigned char* out, int *outlen,
+    const unsigned char* in, int *inlen, const encodingCodepage* codepage);
+
+
 /**
  * ISO8859_15ToUTF8:
  * @out:  a pointer to an array of bytes to store the result
@@ -195,17 +495,153 @@ int isolat1ToUTF8(unsigned char* out, int *outlen,
  * @inlen:  the length of @in
  *
  * Take a block of UTF-8 chars in and try to convert it to an
- * Windows-1252 block of chars out.
+ * Windows-1252 block of chars out. Characters not in Windows-1252 are
+ * replaced by an inverted question mark (0xBF); U+0080 - U+009F become
+ * the bytes of the same value.
  *
  * Returns 0 if success, -2 if the transcoding fails, or -1 otherwise
  * The value of @inlen after return is the number of octets consumed
  *     if the return value is positive, else unpredictable.
- * The value of @outlen after return is the number of octets consumed.
+ * The value of @outlen after return is the number of octets produced.
  */
 int utf8ToCp1252(unsigned char* out, int *outlen,
               const unsigned char* in, int *inlen);
 
 
+/**
+ * Cp1252ToUtf8:
+ * @out:  a pointer to an array of bytes to store the result
+ * @outlen:  the length of @out
+ * @in:  a pointer to an array of Windows-1252 chars
+ * @inlen:  the length of @in
+ *
+ * Take a block of Windows-1252 chars in and convert it to an UTF-8
+ * block of chars out. The five bytes Windows-1252 leaves undefined
+ * (0x81, 0x8D, 0x8F, 0x90, 0x9D) become the C1 controls of the same
+ * value, as with Windows, so any input converts.
+ * Returns 0 if success, or -1 otherwise
+ * The value of @inlen after return is the number of octets consumed
+ * The value of @outlen after return is the number of octets produced.
+ */
+int Cp1252ToUtf8(unsigned char* out, int *outlen,
+              const unsigned char* in, int *inlen);
+
+
+/**
+ * Convert the UTF-8 encoded 'inlen' bytes at 'in' to Windows-1252 in the
+ * caller's buffer 'out' of 'outsize' bytes, as utf8ToLatin9Buffer():
+ * outsize == inlen is always enough, and out == NULL with outsize == 0
+ * just measures the result. Characters not in Windows-1252 are replaced
+ * as by utf8ToCp1252(), so rc == -2 is only returned for malformed or
+ * truncated UTF-8.
+ *
+ * utf8ToCodepage() and utf8ToCodepageAlloc() with &encodingCp1252
+ * convert zero-terminated strings.
+ */
+int utf8ToCp1252Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen);
+
+
+/**
+ * Convert the Windows-1252 encoded 'inlen' bytes at 'in' to UTF-8 in the
+ * caller's buffer 'out' of 'outsize' bytes, as latin9ToUtf8Buffer():
+ * outsize == 3 * inlen is always enough, and out == NULL with
+ * outsize == 0 just measures the result. rc == -2 is never returned.
+ *
+ * codepageToUtf8() and codepageToUtf8Alloc() with &encodingCp1252
+ * convert zero-terminated strings.
+ */
+int cp1252ToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen);
+
+
+/**
+ * The byte orders of UTF-16 and UTF-32 that the functions below convert
+ * from and to. Byte order marks are neither read nor written: a U+FEFF
+ * at the start of 'in' is converted like any other character.
+ *
+ * Where SSE2 is available, runs of 16 US-ASCII characters (for Latin-1,
+ * of any characters below U+0100) and runs of 8 characters that are all
+ * 2 byte UTF-8 sequences (U+0080 - U+07FF) are converted a vector at a
+ * time; with SSSE3 so are runs of 8 that are all 3 byte sequences
+ * (U+0800 - U+FFFF). Text that mixes these lengths, characters above
+ * U+FFFF, and any non-ASCII character of a codepage other than Latin-1
+ * are converted one character at a time.
+ */
+typedef enum {
+    encodingUTF16LE,
+    encodingUTF16BE,
+    encodingUTF32LE,
+    encodingUTF32BE
+} encodingUnicodeForm;
+
+
+/**
+ * Convert the UTF-16 or UTF-32 encoded 'inlen' bytes at 'in', in the byte
+ * order of 'form', to UTF-8 in the caller's buffer 'out' of 'outsize'
+ * bytes, as latin9ToUtf8Buffer(): 'in' need not be aligned, no
+ * terminator is appended, and out == NULL with outsize == 0 just
+ * measures the result. outsize == 2 * inlen is always enough.
+ *
+ * Returns rc == 0 on success, rc == -3 if 'out' is too small (*outlen is
+ * then the size needed, and 'out' holds what fitted), rc == -2 if 'in'
+ * cannot be transcoded (an unpaired surrogate, a UTF-32 unit above
+ * U+10FFFF or in the surrogate range, or a code unit cut off at the end),
+ * or rc == -1 on invalid arguments.
+ */
+int unicodeToUtf8Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form);
+
+
+/**
+ * Convert the UTF-8 encoded 'inlen' bytes at 'in' to UTF-16 or UTF-32 in
+ * the byte order of 'form', as utf8ToLatin9Buffer(). Characters above
+ * U+FFFF become surrogate pairs in UTF-16. outsize == 2 * inlen is
+ * always enough for UTF-16, outsize == 4 * inlen for UTF-32, and
+ * rc == -2 is returned for malformed or truncated UTF-8.
+ */
+int utf8ToUnicodeBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form);
+
+
+/**
+ * unicodeToUtf8Buffer() to Latin-1 rather than UTF-8: outsize == inlen / 2
+ * is always enough. As with UTF8Toisolat1(), characters not in Latin-1
+ * are replaced by an inverted question mark (0xBF), so rc == -2 is only
+ * returned for ill-formed UTF-16 or UTF-32.
+ */
+int unicodeToLatin1Buffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form);
+
+
+/**
+ * utf8ToUnicodeBuffer() from Latin-1 rather than UTF-8: outsize ==
+ * 2 * inlen is always enough for UTF-16, outsize == 4 * inlen for
+ * UTF-32. rc == -2 is never returned.
+ */
+int latin1ToUnicodeBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form);
+
+
+/**
+ * unicodeToLatin1Buffer() for any of the codepages above, e.g. Latin-9
+ * with &encodingISO8859_15: characters not in 'codepage' are replaced
+ * by its substitute, or fail the conversion with rc == -2 if it has none.
+ */
+int unicodeToCodepageBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form,
+    const encodingCodepage* codepage);
+
+
+/**
+ * latin1ToUnicodeBuffer() for any of the codepages above: rc == -2 is
+ * returned for a byte undefined in 'codepage'.
+ */
+int codepageToUnicodeBuffer(const unsigned char* in, size_t inlen,
+    unsigned char* out, size_t outsize, size_t* outlen, encodingUnicodeForm form,
+    const encodingCodepage* codepage);
+
+
 
 #ifdef __cplusplus
 }
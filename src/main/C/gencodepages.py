@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+#
+# gencodepages.py - generates codepages.h, the tables of the single byte
+# codepages for encoding.c, from the codecs of the Python library
+#
+#     python3 gencodepages.py > codepages.h
+#
+# To add a codepage, add a line to CODEPAGES, rerun the script and
+# declare the new encodingCodepage in encoding.h.
+#
+# http://www.opensource.org/licenses/mit-license.php
+
+import codecs
+import sys
+
+# C name, IANA name, Python codec, description
+CODEPAGES = [
+    ("ISO8859_2", "ISO-8859-2", "iso8859_2", "Latin-2, Central European"),
+    ("ISO8859_5", "ISO-8859-5", "iso8859_5", "Cyrillic"),
+    ("ISO8859_7", "ISO-8859-7", "iso8859_7", "Greek"),
+    ("ISO8859_15", "ISO-8859-15", "iso8859_15", "Latin-9, Western European with the euro sign"),
+    ("Cp1250", "windows-1250", "cp1250", "Central European"),
+    ("Cp1251", "windows-1251", "cp1251", "Cyrillic"),
+    ("Cp1253", "windows-1253", "cp1253", "Greek"),
+    ("Cp1252", "windows-1252", "cp1252", "Western European"),
+]
+
+# The C1 controls U+0080 - U+009F are encoded as the bytes of the same
+# value, and the bytes the codec leaves undefined decode to them, as
+# with Windows and utf8ToCp1252() of old.
+LATIN1_C1 = {"Cp1252"}
+
+# Written for characters not in the codepage rather than failing.
+SUBSTITUTE = {"Cp1252": 0xBF}
+
+
+def to_unicode(codec, c1):
+    """code points of the bytes 0x80 - 0xFF, 0 where a byte is undefined"""
+    points = []
+    for byte in range(0x80, 0x100):
+        try:
+            text = codecs.decode(bytes([byte]), codec)
+        except UnicodeDecodeError:
+            text = chr(byte) if c1 else ""
+        points.append(ord(text) if len(text) == 1 else 0)
+        assert points[-1] < 0x10000
+    for byte in range(0x80):
+        assert codecs.decode(bytes([byte]), codec) == chr(byte), "not a superset of US-ASCII"
+    return points
+
+
+def to_utf8(points):
+    """the code points as UTF-8, 4 bytes each: the sequence, padded, then its length"""
+    data = []
+    for point in points:
+        utf8 = chr(point).encode("utf-8") if point != 0 else b""
+        data += list(utf8.ljust(3, b"\0")) + [len(utf8)]
+    return data
+
+
+def from_unicode(points, c1):
+    """
+    The two-level table of UTF8ToSingleByte. The first 48 bytes index
+    64 byte blocks: 0 - 31 by the 5 low bits of a 2 byte lead, giving the
+    block the trailing byte looks up; 32 - 47 by the 4 low bits of a
+    3 byte lead, giving a block that the first trailing byte looks up
+    for the block of the second. Block 0 is all zeros, unmapped.
+    """
+    head = [0] * 48
+    blocks = [[0] * 64]
+
+    def block(table, index):
+        if table[index] == 0:
+            blocks.append([0] * 64)
+            assert len(blocks) <= 256, "too many blocks"
+            table[index] = len(blocks) - 1
+        return blocks[table[index]]
+
+    pairs = list(enumerate(points, 0x80))
+    if c1:
+        pairs += [(point, point) for point in range(0x80, 0xA0) if point not in points]
+    for byte, point in sorted(pairs, key=lambda item: item[1]):
+        if point == 0:
+            continue
+        if point < 0x800:
+            block(head, point >> 6)[point & 0x3F] = byte
+        else:
+            second = block(head, 32 + (point >> 12))
+            block(second, (point >> 6) & 0x3F)[point & 0x3F] = byte
+    return head, blocks
+
+
+def string_rows(data):
+    for i in range(0, len(data), 16):
+        yield '    "' + "".join("\\x%02x" % b for b in data[i:i + 16]) + '"'
+
+
+def main():
+    out = sys.stdout
+    out.write("/*\n"
+              " * codepages.h - tables of the single byte codepages, included by encoding.c only\n"
+              " *\n"
+              " * Generated by gencodepages.py, do not edit.\n"
+              " *\n"
+              " * http://www.opensource.org/licenses/mit-license.php\n"
+              " */\n")
+    for name, iana, codec, description in CODEPAGES:
+        c1 = name in LATIN1_C1
+        points = to_unicode(codec, c1)
+        head, blocks = from_unicode(points, c1)
+        out.write("\n\n/* %s, %s */\n" % (iana, description))
+        out.write("static unsigned short const xmlunicodetable_%s [128] = {\n" % name)
+        for i in range(0, 128, 8):
+            out.write("    " + ", ".join("0x%04x" % p for p in points[i:i + 8]) + ",\n")
+        out.write("};\n\n")
+        out.write("static unsigned char const xmlutf8table_%s [128 * 4] = {\n" % name)
+        out.write("\n".join(string_rows(to_utf8(points))) + "\n};\n\n")
+        out.write("static unsigned char const xmltranscodetable_%s [48 + %d * 64] = {\n" % (name, len(blocks)))
+        data = head + [b for block in blocks for b in block]
+        out.write("\n".join(string_rows(data)) + "\n};\n\n")
+        out.write("const encodingCodepage encoding%s = {\n"
+                  "    \"%s\", xmlunicodetable_%s, xmlutf8table_%s, xmltranscodetable_%s, 0x%02x\n"
+                  "};\n" % (name, iana, name, name, name, SUBSTITUTE.get(name, 0)))
+
+
+if __name__ == "__main__":
+    main()
@@ -811,24 +811,12 @@ int rijndaelKeySetupEnc(uint32_t rk[/*4*(Nr + 1)*/], const uint8_t cipherKey[],
 }
 
 /**
- * Expand the cipher key into the decryption key schedule.
- *
- * @return  the number of rounds for the given cipher key size.
+ * Apply the inverse MixColumn transform to all round keys but the
+ * first and the last.
  */
-int rijndaelKeySetupDec(uint32_t rk[/*4*(Nr + 1)*/], const uint8_t cipherKey[], int keyBits) {
-    int Nr, i, j;
-    uint32_t temp;
+static void rijndaelInvMixRoundKeys(uint32_t rk[/*4*(Nr + 1)*/], int Nr) {
+    int i;
 
-    /* expand the cipher key: */
-    Nr = rijndaelKeySetupEnc(rk, cipherKey, keyBits);
-    /* invert the order of the round keys: */
-    for (i = 0, j = 4*Nr; i < j; i += 4, j -= 4) {
-        temp = rk[i    ]; rk[i    ] = rk[j    ]; rk[j    ] = temp;
-        temp = rk[i + 1]; rk[i + 1] = rk[j + 1]; rk[j + 1] = temp;
-        temp = rk[i + 2]; rk[i + 2] = rk[j + 2]; rk[j + 2] = temp;
-        temp = rk[i + 3]; rk[i + 3] = rk[j + 3]; rk[j + 3] = temp;
-    }
-    /* apply the inverse MixColumn transform to all round keys but the first and the last: */
     for (i = 1; i < Nr; i++) {
         rk += 4;
         rk[0] =
@@ -852,9 +840,48 @@ int rijndaelKeySetupDec(uint32_t rk[/*4*(Nr + 1)*/], const uint8_t cipherKey[],
             Td2[Te4[(rk[3] >>  8) & 0xff] & 0xff] ^
             Td3[Te4[(rk[3]      ) & 0xff] & 0xff];
     }
+}
+
+/**
+ * Expand the cipher key into the decryption key schedule.
+ *
+ * @return  the number of rounds for the given cipher key size.
+ */
+int rijndaelKeySetupDec(uint32_t rk[/*4*(Nr + 1)*/], const uint8_t cipherKey[], int keyBits) {
+    int Nr, i, j;
+    uint32_t temp;
+
+    /* expand the cipher key: */
+    Nr = rijndaelKeySetupEnc(rk, cipherKey, keyBits);
+    /* invert the order of the round keys: */
+    for (i = 0, j = 4*Nr; i < j; i += 4, j -= 4) {
+        temp = rk[i    ]; rk[i    ] = rk[j    ]; rk[j    ] = temp;
+        temp = rk[i + 1]; rk[i + 1] = rk[j + 1]; rk[j + 1] = temp;
+        temp = rk[i + 2]; rk[i + 2] = rk[j + 2]; rk[j + 2] = temp;
+        temp = rk[i + 3]; rk[i + 3] = rk[j + 3]; rk[j + 3] = temp;
+    }
+    rijndaelInvMixRoundKeys(rk, Nr);
     return Nr;
 }
 
+/**
+ * Derive the decryption key schedule from an already expanded
+ * encryption key schedule, without expanding the cipher key again.
+ * 'rk' and 'ek' must not overlap.
+ */
+void rijndaelKeySetupDecFromEnc(uint32_t rk[/*4*(Nr + 1)*/], const uint32_t ek[/*4*(Nr + 1)*/], int Nr) {
+    int i, j;
+
+    /* copy the round keys in reverse order: */
+    for (i = 0, j = 4*Nr; i <= 4*Nr; i += 4, j -= 4) {
+        rk[i    ] = ek[j    ];
+        rk[i + 1] = ek[j + 1];
+        rk[i + 2] = ek[j + 2];
+        rk[i + 3] = ek[j + 3];
+    }
+    rijndaelInvMixRoundKeys(rk, Nr);
+}
+
 void rijndaelEncrypt(const uint32_t rk[/*4*(Nr + 1)*/], int Nr, const uint8_t pt[16], uint8_t ct[16]) {
     uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef FULL_UNROLL
@@ -1036,6 +1063,80 @@ void rijndaelEncrypt(const uint32_t rk[/*4*(Nr + 1)*/], int Nr, const uint8_t pt
     PUTU32(ct + 12, s3);
 }
 
+/*
+ * Encrypt a run of independent blocks with the same key schedule.
+ *
+ * Two blocks are carried through every round together, so the table
+ * lookups of one block can be issued while those of the other are
+ * still in flight.  This is only useful for modes whose blocks do not
+ * depend on each other (ECB, CTR, CFB decryption, keystream batches);
+ * chaining modes must keep calling rijndaelEncrypt.
+ *
+ * 'pt' and 'ct' may be the same buffer.
+ */
+#define ENC_ROUND(d0, d1, d2, d3, s0, s1, s2, s3, k) {   \
+    d0 = Te0[(s0 >> 24)       ] ^ Te1[(s1 >> 16) & 0xff] ^ \
+         Te2[(s2 >>  8) & 0xff] ^ Te3[(s3      ) & 0xff] ^ (k)[0]; \
+    d1 = Te0[(s1 >> 24)       ] ^ Te1[(s2 >> 16) & 0xff] ^ \
+         Te2[(s3 >>  8) & 0xff] ^ Te3[(s0      ) & 0xff] ^ (k)[1]; \
+    d2 = Te0[(s2 >> 24)       ] ^ Te1[(s3 >> 16) & 0xff] ^ \
+         Te2[(s0 >>  8) & 0xff] ^ Te3[(s1      ) & 0xff] ^ (k)[2]; \
+    d3 = Te0[(s3 >> 24)       ] ^ Te1[(s0 >> 16) & 0xff] ^ \
+         Te2[(s1 >>  8) & 0xff] ^ Te3[(s2      ) & 0xff] ^ (k)[3]; \
+}
+
+#define ENC_FINAL(d, s0, s1, s2, s3, k) { \
+    PUTU32(d     , \
+        (Te4[(s0 >> 24)       ] & 0xff000000) ^ (Te4[(s1 >> 16) & 0xff] & 0x00ff0000) ^ \
+        (Te4[(s2 >>  8) & 0xff] & 0x0000ff00) ^ (Te4[(s3      ) & 0xff] & 0x000000ff) ^ (k)[0]); \
+    PUTU32(d +  4, \
+        (Te4[(s1 >> 24)       ] & 0xff000000) ^ (Te4[(s2 >> 16) & 0xff] & 0x00ff0000) ^ \
+        (Te4[(s3 >>  8) & 0xff] & 0x0000ff00) ^ (Te4[(s0      ) & 0xff] & 0x000000ff) ^ (k)[1]); \
+    PUTU32(d +  8, \
+        (Te4[(s2 >> 24)       ] & 0xff000000) ^ (Te4[(s3 >> 16) & 0xff] & 0x00ff0000) ^ \
+        (Te4[(s0 >>  8) & 0xff] & 0x0000ff00) ^ (Te4[(s1      ) & 0xff] & 0x000000ff) ^ (k)[2]); \
+    PUTU32(d + 12, \
+        (Te4[(s3 >> 24)       ] & 0xff000000) ^ (Te4[(s0 >> 16) & 0xff] & 0x00ff0000) ^ \
+        (Te4[(s1 >>  8) & 0xff] & 0x0000ff00) ^ (Te4[(s2      ) & 0xff] & 0x000000ff) ^ (k)[3]); \
+}
+
+void rijndaelEncryptBlocks(const uint32_t rk[/*4*(Nr + 1)*/], int Nr, const uint8_t *pt, uint8_t *ct, size_t blocks) {
+    uint32_t a0, a1, a2, a3, b0, b1, b2, b3;
+    uint32_t u0, u1, u2, u3, v0, v1, v2, v3;
+    const uint32_t *k;
+    int r;
+
+    for ( ; blocks >= 2; blocks -= 2, pt += 32, ct += 32) {
+        a0 = GETU32(pt     ) ^ rk[0];
+        a1 = GETU32(pt +  4) ^ rk[1];
+        a2 = GETU32(pt +  8) ^ rk[2];
+        a3 = GETU32(pt + 12) ^ rk[3];
+        b0 = GETU32(pt + 16) ^ rk[0];
+        b1 = GETU32(pt + 20) ^ rk[1];
+        b2 = GETU32(pt + 24) ^ rk[2];
+        b3 = GETU32(pt + 28) ^ rk[3];
+        k = rk;
+        for (r = Nr >> 1; ; ) {
+            ENC_ROUND(u0, u1, u2, u3, a0, a1, a2, a3, k + 4);
+            ENC_ROUND(v0, v1, v2, v3, b0, b1, b2, b3, k + 4);
+            k += 8;
+            if (--r == 0) {
+                break;
+            }
+            ENC_ROUND(a0, a1, a2, a3, u0, u1, u2, u3, k);
+            ENC_ROUND(b0, b1, b2, b3, v0, v1, v2, v3, k);
+        }
+        ENC_FINAL(ct     , u0, u1, u2, u3, k);
+        ENC_FINAL(ct + 16, v0, v1, v2, v3, k);
+    }
+    if (blocks) {
+        rijndaelEncrypt(rk, Nr, pt, ct);
+    }
+}
+
+#undef ENC_ROUND
+#undef ENC_FINAL
+
 void rijndaelDecrypt(const uint32_t rk[/*4*(Nr + 1)*/], int Nr, const uint8_t ct[16], uint8_t pt[16]) {
     uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef FULL_UNROLL
@@ -33,13 +33,16 @@
 #else
 #include <stdint.h>
 #endif
+#include <stddef.h>
 
 
 /* symbol renaming */
 #define rijndaelKeySetupEnc _hc_rijndaelKeySetupEnc
 #define rijndaelKeySetupDec _hc_rijndaelKeySetupDec
+#define rijndaelKeySetupDecFromEnc _hc_rijndaelKeySetupDecFromEnc
 #define rijndaelEncrypt _hc_rijndaelEncrypt
 #define rijndaelDecrypt _hc_rijndaelDecrypt
+#define rijndaelEncryptBlocks _hc_rijndaelEncryptBlocks
 
 #define RIJNDAEL_MAXKC  (256/32)
 #define RIJNDAEL_MAXKB  (256/8)
@@ -47,7 +50,9 @@
 
 int rijndaelKeySetupEnc(uint32_t rk[/*4*(Nr + 1)*/], const uint8_t cipherKey[], int keyBits);
 int rijndaelKeySetupDec(uint32_t rk[/*4*(Nr + 1)*/], const uint8_t cipherKey[], int keyBits);
+void rijndaelKeySetupDecFromEnc(uint32_t rk[/*4*(Nr + 1)*/], const uint32_t ek[/*4*(Nr + 1)*/], int Nr);
 void rijndaelEncrypt(const uint32_t rk[/*4*(Nr + 1)*/], int Nr, const uint8_t pt[16], uint8_t ct[16]);
 void rijndaelDecrypt(const uint32_t rk[/*4*(Nr + 1)*/], int Nr, const uint8_t ct[16], uint8_t pt[16]);
+void rijndaelEncryptBlocks(const uint32_t rk[/*4*(Nr + 1)*/], int Nr, const uint8_t *pt, uint8_t *ct, size_t blocks);
 
 #endif /* __RIJNDAEL_ALG_FST_H */
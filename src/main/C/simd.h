@@ -0,0 +1,38 @@
+/*
+ * simd.h - compile time selection of the vector code paths
+ *
+ * The kernels follow the instruction set the compiler targets
+ * (e.g. -mssse3, -mavx2, -march=icelake-client or /arch:AVX2); there is
+ * no runtime dispatch.
+ * Define NO_SIMD to build the portable code only.
+ *
+ * http://www.opensource.org/licenses/mit-license.php
+ */
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#if !defined(NO_SIMD)
+#  if defined(__AVX512VBMI2__) && defined(__AVX512BW__) && defined(__BMI2__)
+#    define SIMD_AVX512VBMI2 1
+#  endif
+#  if defined(__AVX2__) || defined(SIMD_AVX512VBMI2)
+#    define SIMD_AVX2 1
+#  endif
+#  if defined(__SSSE3__) || defined(SIMD_AVX2)
+#    define SIMD_SSSE3 1
+#  endif
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(SIMD_SSSE3)
+#    define SIMD_SSE2 1
+#  endif
+#endif /* !NO_SIMD */
+
+#if defined(SIMD_AVX2)
+#  include <immintrin.h>
+#elif defined(SIMD_SSSE3)
+#  include <tmmintrin.h>
+#elif defined(SIMD_SSE2)
+#  include <emmintrin.h>
+#endif
+
+#endif /* SIMD_H */